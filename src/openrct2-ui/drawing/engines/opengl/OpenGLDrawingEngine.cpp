@@ -370,6 +370,11 @@ public:
         _drawingContext->GetTextureCache()->InvalidateImage(image);
     }
 
+    SpriteCacheStats GetSpriteCacheStats() override
+    {
+        return {};
+    }
+
     DrawPixelInfo* GetDPI()
     {
         return &_bitsDPI;
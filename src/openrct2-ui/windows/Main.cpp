@@ -45,7 +45,8 @@ public:
 
     void OnDraw(DrawPixelInfo& dpi) override
     {
-        ViewportRender(dpi, viewport, { { dpi.x, dpi.y }, { dpi.x + dpi.width, dpi.y + dpi.height } });
+        ViewportRender(
+            dpi, viewport, { { dpi.x, dpi.y }, { dpi.x + dpi.width, dpi.y + dpi.height } }, gConfigGeneral.MultiThreading);
     }
 
 private:
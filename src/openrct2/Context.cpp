@@ -181,6 +181,9 @@ namespace OpenRCT2
             _scriptEngine.StopUnloadRegisterAllPlugins();
 #endif
 
+            // Let an autosave that is still being written finish.
+            GameAutosaveUpdate(true);
+
             GameActions::ClearQueue();
 #ifndef DISABLE_NETWORK
             _network.Close();
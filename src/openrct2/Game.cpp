@@ -70,7 +70,9 @@
 #include "world/Surface.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdio>
+#include <future>
 #include <iterator>
 #include <memory>
 
@@ -665,6 +667,9 @@ void SaveGameAs()
     ContextOpenIntent(intent.get());
 }
 
+// Result of the autosave that is being written on a background thread.
+static std::future<bool> _autosaveResult;
+
 static void LimitAutosaveCount(const size_t numberOfFilesToKeep, bool processLandscapeFolder)
 {
     size_t autosavesCount = 0;
@@ -726,6 +731,9 @@ static void LimitAutosaveCount(const size_t numberOfFilesToKeep, bool processLan
 
 void GameAutosave()
 {
+    // The previous autosave may still be writing its file.
+    GameAutosaveUpdate(true);
+
     auto subDirectory = DIRID::SAVE;
     const char* fileExtension = ".park";
     uint32_t saveFlags = 0x80000000;
@@ -761,8 +769,22 @@ void GameAutosave()
         File::Copy(path, backupPath, true);
     }
 
-    if (!ScenarioSave(path, saveFlags))
+    _autosaveResult = ScenarioSaveAsync(path, saveFlags);
+}
+
+void GameAutosaveUpdate(bool wait)
+{
+    if (!_autosaveResult.valid())
+        return;
+
+    if (!wait && _autosaveResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+
+    if (!_autosaveResult.get())
+    {
         Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+        ContextShowError(STR_GAME_SAVE_FAILED, STR_NONE, {});
+    }
 }
 
 static void GameLoadOrQuitNoSavePromptCallback(int32_t result, const utf8* path)
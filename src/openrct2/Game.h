@@ -173,6 +173,7 @@ void SaveGameAs();
 void SaveGameCmd(u8string_view name = {});
 void SaveGameWithName(u8string_view name);
 void GameAutosave();
+void GameAutosaveUpdate(bool wait = false);
 void RCT2StringToUTF8Self(char* buffer, size_t length);
 void GameFixSaveVars();
 void StartSilentRecord();
@@ -22,7 +22,13 @@
 #include "entity/Staff.h"
 #include "ride/Vehicle.h"
 
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
 static constexpr size_t MaximumGameStateSnapshots = 32;
+// Every n-th capture stores all entities, the captures in between only store the difference to the previous one.
+static constexpr uint32_t GameStateSnapshotKeyframeInterval = 8;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
 #pragma pack(push, 1)
@@ -38,22 +44,181 @@ union EntitySnapshot
 assert_struct_size(EntitySnapshot, 0x200);
 #pragma pack(pop)
 
-struct GameStateSnapshot_t
+static void WriteDeltaValue(std::vector<uint8_t>& delta, uint32_t value)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    delta.insert(delta.end(), bytes, bytes + sizeof(value));
+}
+
+static uint32_t ReadDeltaValue(const std::vector<uint8_t>& delta, size_t& pos)
 {
-    GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
+    uint32_t value = 0;
+    if (pos + sizeof(value) <= delta.size())
     {
-        tick = mv.tick;
-        storedSprites = std::move(mv.storedSprites);
-        return *this;
+        std::memcpy(&value, delta.data() + pos, sizeof(value));
     }
+    pos += sizeof(value);
+    return value;
+}
+
+/*
+ * Encodes data as the difference to base. The delta starts with the length of data followed by runs of
+ * [number of equal bytes][number of changed bytes][changed bytes XOR base], bytes past the end of base
+ * are compared against zero.
+ */
+static std::vector<uint8_t> EncodeDelta(const std::vector<uint8_t>& base, const std::vector<uint8_t>& data)
+{
+    // Equal bytes shorter than this are stored as part of the changed bytes, a new run costs as much.
+    constexpr size_t MinEqualBytes = 2 * sizeof(uint32_t);
+
+    const auto xorAt = [&](size_t i) -> uint8_t { return data[i] ^ (i < base.size() ? base[i] : 0); };
+
+    std::vector<uint8_t> delta;
+    WriteDeltaValue(delta, static_cast<uint32_t>(data.size()));
+
+    size_t lastEnd = 0;
+    size_t i = 0;
+    while (i < data.size())
+    {
+        if (xorAt(i) == 0)
+        {
+            i++;
+            continue;
+        }
 
+        const size_t start = i;
+        size_t end = i;
+        while (i < data.size())
+        {
+            if (xorAt(i) != 0)
+            {
+                end = ++i;
+            }
+            else if (++i - end >= MinEqualBytes)
+            {
+                break;
+            }
+        }
+
+        WriteDeltaValue(delta, static_cast<uint32_t>(start - lastEnd));
+        WriteDeltaValue(delta, static_cast<uint32_t>(end - start));
+        for (size_t j = start; j < end; j++)
+        {
+            delta.push_back(xorAt(j));
+        }
+        lastEnd = end;
+        i = end;
+    }
+    return delta;
+}
+
+static void ApplyDelta(std::vector<uint8_t>& data, const std::vector<uint8_t>& delta)
+{
+    size_t pos = 0;
+    data.resize(ReadDeltaValue(delta, pos));
+
+    size_t offset = 0;
+    while (pos < delta.size())
+    {
+        offset += ReadDeltaValue(delta, pos);
+        const size_t count = ReadDeltaValue(delta, pos);
+        if (offset + count > data.size() || pos + count > delta.size())
+        {
+            LOG_ERROR("Snapshot delta corrupted!");
+            return;
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            data[offset++] ^= delta[pos++];
+        }
+    }
+}
+
+// The serialised type and data of one entity. In a delta the data is the difference to the entity's data in the
+// previous capture, and empty if the entity was removed.
+struct SnapshotEntity
+{
+    uint32_t Id;
+    std::vector<uint8_t> Data;
+};
+
+struct GameStateSnapshot_t : public std::enable_shared_from_this<GameStateSnapshot_t>
+{
     uint32_t tick = InvalidTick;
     uint32_t srand0 = 0;
 
+    // Only used by snapshots that were not captured locally.
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
 
-    template<typename T> bool EntitySizeCheck(DataSerialiser& ds)
+    // The entities of a captured keyframe sorted by id, or of a capture in between only those that changed since the
+    // previous capture, which is kept as the delta base.
+    std::shared_ptr<const GameStateSnapshot_t> deltaBase;
+    std::vector<SnapshotEntity> storedEntities;
+    bool captured = false;
+
+    void GetStoredEntities(std::vector<SnapshotEntity>& entities) const
+    {
+        if (deltaBase == nullptr)
+        {
+            entities = storedEntities;
+            return;
+        }
+
+        std::vector<SnapshotEntity> baseEntities;
+        deltaBase->GetStoredEntities(baseEntities);
+
+        // Both lists are sorted by id, entities without a delta are unchanged.
+        entities.clear();
+        entities.reserve(baseEntities.size() + storedEntities.size());
+        auto it = baseEntities.begin();
+        for (const auto& delta : storedEntities)
+        {
+            for (; it != baseEntities.end() && it->Id < delta.Id; it++)
+            {
+                entities.push_back(std::move(*it));
+            }
+
+            SnapshotEntity entity{ delta.Id, {} };
+            if (it != baseEntities.end() && it->Id == delta.Id)
+            {
+                entity.Data = std::move(it->Data);
+                it++;
+            }
+            if (!delta.Data.empty())
+            {
+                ApplyDelta(entity.Data, delta.Data);
+                entities.push_back(std::move(entity));
+            }
+        }
+        std::move(it, baseEntities.end(), std::back_inserter(entities));
+    }
+
+    OpenRCT2::MemoryStream GetStoredSprites() const
+    {
+        if (!captured)
+        {
+            return storedSprites;
+        }
+
+        std::vector<SnapshotEntity> entities;
+        GetStoredEntities(entities);
+
+        // Same layout as SerialiseSprites writes.
+        OpenRCT2::MemoryStream stream;
+        DataSerialiser ds(true, stream);
+        EntitiesSizeCheck<Vehicle, Guest, Staff, Litter, MoneyEffect, Balloon, Duck, JumpingFountain, SteamParticle>(ds);
+        uint32_t numSavedSprites = static_cast<uint32_t>(entities.size());
+        ds << numSavedSprites;
+        for (auto& entity : entities)
+        {
+            ds << entity.Id;
+            stream.Write(entity.Data.data(), entity.Data.size());
+        }
+        return stream;
+    }
+
+    template<typename T> static bool EntitySizeCheck(DataSerialiser& ds)
     {
         uint32_t size = sizeof(T);
         ds << size;
@@ -63,33 +228,65 @@ struct GameStateSnapshot_t
         }
         return true;
     }
-    template<typename... T> bool EntitiesSizeCheck(DataSerialiser& ds)
+    template<typename... T> static bool EntitiesSizeCheck(DataSerialiser& ds)
     {
         return (EntitySizeCheck<T>(ds) && ...);
     }
 
-    // Must pass a function that can access the sprite.
-    void SerialiseSprites(std::function<EntitySnapshot*(const EntityId)> getEntity, const size_t numSprites, bool saving)
+    static void SerialiseSprite(DataSerialiser& ds, EntitySnapshot& sprite)
     {
-        const bool loading = !saving;
+        ds << sprite.base.Type;
 
-        storedSprites.SetPosition(0);
-        DataSerialiser ds(saving, storedSprites);
+        switch (sprite.base.Type)
+        {
+            case EntityType::Vehicle:
+                reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Guest:
+                reinterpret_cast<Guest&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Staff:
+                reinterpret_cast<Staff&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Litter:
+                reinterpret_cast<Litter&>(sprite).Serialise(ds);
+                break;
+            case EntityType::MoneyEffect:
+                reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Balloon:
+                reinterpret_cast<Balloon&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Duck:
+                reinterpret_cast<Duck&>(sprite).Serialise(ds);
+                break;
+            case EntityType::JumpingFountain:
+                reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
+                break;
+            case EntityType::SteamParticle:
+                reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Null:
+                break;
+            default:
+                break;
+        }
+    }
 
-        std::vector<uint32_t> indexTable;
-        indexTable.reserve(numSprites);
+    // Must pass a function that can access the sprite, when saving indexTable lists the sprites to save.
+    static void SerialiseSprites(
+        OpenRCT2::MemoryStream& stream, std::function<EntitySnapshot*(const EntityId)> getEntity,
+        std::vector<uint32_t>& indexTable, bool saving)
+    {
+        const bool loading = !saving;
+
+        stream.SetPosition(0);
+        DataSerialiser ds(saving, stream);
 
         uint32_t numSavedSprites = 0;
 
         if (saving)
         {
-            for (EntityId::UnderlyingType i = 0; i < numSprites; i++)
-            {
-                auto entity = getEntity(EntityId::FromUnderlying(i));
-                if (entity == nullptr || entity->base.Type == EntityType::Null)
-                    continue;
-                indexTable.push_back(static_cast<uint32_t>(i));
-            }
             numSavedSprites = static_cast<uint32_t>(indexTable.size());
         }
 
@@ -118,58 +315,46 @@ struct GameStateSnapshot_t
                 LOG_ERROR("Entity index corrupted!");
                 return;
             }
-            auto& sprite = *entity;
-
-            ds << sprite.base.Type;
-
-            switch (sprite.base.Type)
-            {
-                case EntityType::Vehicle:
-                    reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Guest:
-                    reinterpret_cast<Guest&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Staff:
-                    reinterpret_cast<Staff&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Litter:
-                    reinterpret_cast<Litter&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::MoneyEffect:
-                    reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Balloon:
-                    reinterpret_cast<Balloon&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Duck:
-                    reinterpret_cast<Duck&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::JumpingFountain:
-                    reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::SteamParticle:
-                    reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Null:
-                    break;
-                default:
-                    break;
-            }
+            SerialiseSprite(ds, *entity);
         }
     }
 };
 
+namespace
+{
+    struct CapturedEntity
+    {
+        std::vector<std::byte> Memory;
+        std::vector<uint8_t> Data;
+    };
+} // namespace
+
 struct GameStateSnapshots final : public IGameStateSnapshots
 {
     virtual void Reset() override final
     {
         _snapshots.clear();
+        _linkedSnapshots.clear();
+        _lastCapture = nullptr;
+        _lastCaptureIds.clear();
+        _capturedEntities.clear();
+        _capturesSinceKeyframe = 0;
     }
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
     {
-        auto snapshot = std::make_unique<GameStateSnapshot_t>();
+        if (_snapshots.size() == _snapshots.capacity())
+        {
+            // The oldest snapshot is removed, captures after it that still need it keep it alive as their delta base.
+            const auto& oldest = _snapshots.front();
+            auto it = _linkedSnapshots.find(oldest->tick);
+            if (it != _linkedSnapshots.end() && it->second == oldest.get())
+            {
+                _linkedSnapshots.erase(it);
+            }
+        }
+
+        auto snapshot = std::make_shared<GameStateSnapshot_t>();
         _snapshots.push_back(std::move(snapshot));
 
         return *_snapshots.back();
@@ -179,23 +364,82 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         snapshot.tick = tick;
         snapshot.srand0 = srand0;
+        _linkedSnapshots[tick] = &snapshot;
     }
 
     virtual void Capture(GameStateSnapshot_t& snapshot) override final
     {
-        snapshot.SerialiseSprites(
-            [](const EntityId index) { return reinterpret_cast<EntitySnapshot*>(GetEntity(index)); }, MAX_ENTITIES, true);
+        std::vector<uint32_t> indexTable;
+        for (auto type = 0; type < EnumValue(EntityType::Count); type++)
+        {
+            for (auto id : GetEntityList(static_cast<EntityType>(type)))
+            {
+                indexTable.push_back(id.ToUnderlying());
+            }
+        }
+        std::sort(indexTable.begin(), indexTable.end());
+
+        const bool isKeyframe = _lastCapture == nullptr || _lastCapture.get() == &snapshot
+            || _capturesSinceKeyframe >= GameStateSnapshotKeyframeInterval;
+
+        snapshot.storedSprites = OpenRCT2::MemoryStream();
+        snapshot.storedEntities.clear();
+        snapshot.deltaBase = isKeyframe ? nullptr : _lastCapture;
+        snapshot.captured = true;
+        _capturesSinceKeyframe = isKeyframe ? 1 : _capturesSinceKeyframe + 1;
+
+        // Entities are only serialised again when their memory changed since the previous capture, the deltas only
+        // contain the entities that changed, so spawning or removing an entity does not affect the others.
+        _capturedEntities.resize(MAX_ENTITIES);
+        auto lastIt = _lastCaptureIds.begin();
+        for (auto id : indexTable)
+        {
+            for (; lastIt != _lastCaptureIds.end() && *lastIt < id; lastIt++)
+            {
+                RemoveCapturedEntity(snapshot, *lastIt, isKeyframe);
+            }
+            if (lastIt != _lastCaptureIds.end() && *lastIt == id)
+            {
+                lastIt++;
+            }
+
+            auto& captured = _capturedEntities[id];
+            const auto* memory = reinterpret_cast<const std::byte*>(GetEntity(EntityId::FromUnderlying(id)));
+            if (captured.Memory.size() == sizeof(EntitySnapshot)
+                && std::memcmp(captured.Memory.data(), memory, sizeof(EntitySnapshot)) == 0)
+            {
+                if (isKeyframe)
+                {
+                    snapshot.storedEntities.push_back({ id, captured.Data });
+                }
+                continue;
+            }
 
-        // LOG_INFO("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
+            OpenRCT2::MemoryStream stream;
+            DataSerialiser ds(true, stream);
+            GameStateSnapshot_t::SerialiseSprite(
+                ds, *reinterpret_cast<EntitySnapshot*>(GetEntity(EntityId::FromUnderlying(id))));
+            const auto* bytes = static_cast<const uint8_t*>(stream.GetData());
+            std::vector<uint8_t> data(bytes, bytes + stream.GetLength());
+
+            snapshot.storedEntities.push_back({ id, isKeyframe ? data : EncodeDelta(captured.Data, data) });
+            captured.Memory.assign(memory, memory + sizeof(EntitySnapshot));
+            captured.Data = std::move(data);
+        }
+        for (; lastIt != _lastCaptureIds.end(); lastIt++)
+        {
+            RemoveCapturedEntity(snapshot, *lastIt, isKeyframe);
+        }
+
+        _lastCapture = snapshot.shared_from_this();
+        _lastCaptureIds = std::move(indexTable);
     }
 
     virtual const GameStateSnapshot_t* GetLinkedSnapshot(uint32_t tick) const override final
     {
-        for (size_t i = 0; i < _snapshots.size(); i++)
-        {
-            if (_snapshots[i]->tick == tick)
-                return _snapshots[i].get();
-        }
+        auto it = _linkedSnapshots.find(tick);
+        if (it != _linkedSnapshots.end())
+            return it->second;
         return nullptr;
     }
 
@@ -203,11 +447,22 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         ds << snapshot.tick;
         ds << snapshot.srand0;
-        ds << snapshot.storedSprites;
+        if (ds.IsSaving())
+        {
+            auto storedSprites = snapshot.GetStoredSprites();
+            ds << storedSprites;
+        }
+        else
+        {
+            snapshot.deltaBase = nullptr;
+            snapshot.storedEntities.clear();
+            snapshot.captured = false;
+            ds << snapshot.storedSprites;
+        }
         ds << snapshot.parkParameters;
     }
 
-    std::vector<EntitySnapshot> BuildSpriteList(GameStateSnapshot_t& snapshot) const
+    std::vector<EntitySnapshot> BuildSpriteList(const GameStateSnapshot_t& snapshot) const
     {
         std::vector<EntitySnapshot> spriteList;
         spriteList.resize(MAX_ENTITIES);
@@ -218,8 +473,11 @@ struct GameStateSnapshots final : public IGameStateSnapshots
             sprite.base.Type = EntityType::Null;
         }
 
-        snapshot.SerialiseSprites(
-            [&spriteList](const EntityId index) { return &spriteList[index.ToUnderlying()]; }, MAX_ENTITIES, false);
+        auto storedSprites = snapshot.GetStoredSprites();
+        std::vector<uint32_t> indexTable;
+        GameStateSnapshot_t::SerialiseSprites(
+            storedSprites, [&spriteList](const EntityId index) { return &spriteList[index.ToUnderlying()]; }, indexTable,
+            false);
 
         return spriteList;
     }
@@ -629,8 +887,8 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         res.srand0Left = base.srand0;
         res.srand0Right = cmp.srand0;
 
-        std::vector<EntitySnapshot> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
-        std::vector<EntitySnapshot> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+        std::vector<EntitySnapshot> spritesBase = BuildSpriteList(base);
+        std::vector<EntitySnapshot> spritesCmp = BuildSpriteList(cmp);
 
         for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
         {
@@ -786,7 +1044,24 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     }
 
 private:
-    CircularBuffer<std::unique_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+    CircularBuffer<std::shared_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+    std::unordered_map<uint32_t, const GameStateSnapshot_t*> _linkedSnapshots;
+
+    // The last captured snapshot and its entities, the next capture is stored as the delta to them.
+    std::shared_ptr<const GameStateSnapshot_t> _lastCapture;
+    std::vector<uint32_t> _lastCaptureIds;
+    // The memory and serialised data of every entity at the last capture, by id.
+    std::vector<CapturedEntity> _capturedEntities;
+    uint32_t _capturesSinceKeyframe = 0;
+
+    void RemoveCapturedEntity(GameStateSnapshot_t& snapshot, uint32_t id, bool isKeyframe)
+    {
+        if (!isKeyframe)
+        {
+            snapshot.storedEntities.push_back({ id, {} });
+        }
+        _capturedEntities[id] = {};
+    }
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots()
@@ -59,6 +59,8 @@ struct GameStateCompareData
  * the oldest snapshot will be removed from the buffer. Never store the snapshot pointer
  * as it may become invalid at any time when a snapshot is created, rather Link the snapshot
  * to a specific tick which can be obtained by that later again assuming its still valid.
+ * Captured snapshots in between keyframes only store the difference to the previous capture,
+ * a captured snapshot must not be loaded into afterwards.
  */
 struct IGameStateSnapshots
 {
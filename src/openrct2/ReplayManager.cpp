@@ -480,6 +480,21 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual std::vector<std::pair<uint32_t, std::unique_ptr<GameAction>>> TakePlaybackActions() override
+        {
+            std::vector<std::pair<uint32_t, std::unique_ptr<GameAction>>> actions;
+            if (_currentReplay == nullptr)
+                return actions;
+
+            auto& replayQueue = _currentReplay->commands;
+            while (!replayQueue.empty())
+            {
+                auto node = replayQueue.extract(replayQueue.begin());
+                actions.emplace_back(node.value().tick, std::move(node.value().action));
+            }
+            return actions;
+        }
+
         virtual bool NormaliseReplay(const std::string& file, const std::string& outFile) override
         {
             _mode = ReplayMode::NORMALISATION;
@@ -14,6 +14,8 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 class GameAction;
 
@@ -62,6 +64,12 @@ namespace OpenRCT2
         virtual bool IsPlaybackStateMismatching() const = 0;
         virtual bool StopPlayback() = 0;
 
+        /**
+         * Removes the game actions from the current playback so that the caller can execute them, the playback
+         * keeps comparing the game state with the recorded checksums.
+         */
+        virtual std::vector<std::pair<uint32_t, std::unique_ptr<GameAction>>> TakePlaybackActions() = 0;
+
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
     };
 
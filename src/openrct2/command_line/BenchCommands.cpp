@@ -0,0 +1,1472 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../actions/GameAction.h"
+#include "../config/Config.h"
+#include "../core/Console.hpp"
+#include "../core/Imaging.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../drawing/Drawing.h"
+#include "../drawing/Image.h"
+#include "../drawing/ImageImporter.h"
+#include "../drawing/X8SpriteCache.h"
+#include "../entity/EntityIdSet.h"
+#include "../entity/EntityList.h"
+#include "../entity/EntityRegistry.h"
+#include "../entity/Guest.h"
+#include "../entity/Litter.h"
+#include "../network/NetworkBase.h"
+#include "../network/NetworkSimulatedClient.h"
+#include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
+#include "../sprites.h"
+#include "../util/Util.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdlib>
+#include <list>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+using namespace OpenRCT2;
+
+static int32_t _warmupTicks = 100;
+static u8string _outputPath;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_warmupTicks, NAC, "warmup", "number of ticks to run before measuring (default 100)" },
+    { CMDLINE_TYPE_STRING,  &_outputPath,  NAC, "output", "path of the JSON file to write the results to"         },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBench(CommandLineArgEnumerator* argEnumerator);
+
+static constexpr CommandLineOptionDefinition BenchGraphicsOptionsDef[]
+{
+    { CMDLINE_TYPE_STRING, &_outputPath, NAC, "output", "path of the JSON file to write the results to" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchGraphics(CommandLineArgEnumerator* argEnumerator);
+
+static constexpr CommandLineOptionDefinition BenchSpritesOptionsDef[]
+{
+    { CMDLINE_TYPE_STRING, &_outputPath, NAC, "output", "path of the JSON file to write the results to" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchSprites(CommandLineArgEnumerator* argEnumerator);
+
+static constexpr CommandLineOptionDefinition BenchEntitiesOptionsDef[]
+{
+    { CMDLINE_TYPE_STRING, &_outputPath, NAC, "output", "path of the JSON file to write the results to" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchEntities(CommandLineArgEnumerator* argEnumerator);
+
+#ifndef DISABLE_NETWORK
+static int32_t _networkClients = 32;
+static int32_t _networkPort = 11760;
+
+static constexpr CommandLineOptionDefinition BenchNetworkOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_networkClients, NAC, "clients", "number of simulated clients (default 32)"      },
+    { CMDLINE_TYPE_INTEGER, &_networkPort,    NAC, "port",    "localhost port of the server (default 11760)"  },
+    { CMDLINE_TYPE_STRING,  &_outputPath,     NAC, "output",  "path of the JSON file to write the results to" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchNetwork(CommandLineArgEnumerator* argEnumerator);
+#endif
+
+const CommandLineCommand CommandLine::BenchCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> <ticks>", BenchOptionsDef, HandleBench),
+    DefineCommand("graphics", "[iterations]", BenchGraphicsOptionsDef, HandleBenchGraphics),
+    DefineCommand("sprites", "[iterations]", BenchSpritesOptionsDef, HandleBenchSprites),
+    DefineCommand("entities", "[entities]", BenchEntitiesOptionsDef, HandleBenchEntities),
+#ifndef DISABLE_NETWORK
+    DefineCommand("network", "<park or parkrep> [ticks]", BenchNetworkOptionsDef, HandleBenchNetwork),
+#endif
+    CommandTableEnd
+};
+// clang-format on
+
+namespace
+{
+    struct TimingSummary
+    {
+        double Min{};
+        double Median{};
+        double P99{};
+        double Max{};
+        double Mean{};
+    };
+
+    struct FunctionTiming
+    {
+        Profiling::Function* Func{};
+        uint64_t Calls{};
+        double Total{};
+        std::vector<double> TickTimes;
+    };
+
+    struct MemoryUsage
+    {
+        // Resident pages that are private to the process and the ones backed by files shared with other processes
+        int64_t Private{};
+        int64_t Shared{};
+    };
+
+    struct CacheCounts
+    {
+        uint64_t References{};
+        uint64_t Misses{};
+    };
+
+    // Hardware counters of the cache references and misses of the calling thread. They are only implemented on Linux
+    // and can still be unavailable there, e.g. in virtual machines or when perf_event_paranoid does not allow them.
+    class CacheCounters
+    {
+    private:
+        int _referencesFd = -1;
+        int _missesFd = -1;
+
+#ifdef __linux__
+        static int Open(uint64_t config)
+        {
+            perf_event_attr attr{};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = config;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+
+        static uint64_t ReadCounter(int fd)
+        {
+            uint64_t value{};
+            if (read(fd, &value, sizeof(value)) != sizeof(value))
+                return 0;
+            return value;
+        }
+#endif
+
+    public:
+        CacheCounters()
+        {
+#ifdef __linux__
+            _referencesFd = Open(PERF_COUNT_HW_CACHE_REFERENCES);
+            _missesFd = Open(PERF_COUNT_HW_CACHE_MISSES);
+#endif
+        }
+
+        CacheCounters(const CacheCounters&) = delete;
+        CacheCounters& operator=(const CacheCounters&) = delete;
+
+        ~CacheCounters()
+        {
+#ifdef __linux__
+            if (_referencesFd != -1)
+                close(_referencesFd);
+            if (_missesFd != -1)
+                close(_missesFd);
+#endif
+        }
+
+        bool IsAvailable() const
+        {
+            return _referencesFd != -1 && _missesFd != -1;
+        }
+
+        CacheCounts Read() const
+        {
+            CacheCounts counts;
+#ifdef __linux__
+            if (IsAvailable())
+            {
+                counts.References = ReadCounter(_referencesFd);
+                counts.Misses = ReadCounter(_missesFd);
+            }
+#endif
+            return counts;
+        }
+    };
+} // namespace
+
+static double GetPercentile(const std::vector<double>& sorted, double percentile)
+{
+    if (sorted.empty())
+        return 0.0;
+
+    auto rank = static_cast<size_t>(std::ceil(percentile * sorted.size()));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+static TimingSummary Summarise(std::vector<double> samples)
+{
+    TimingSummary summary;
+    if (samples.empty())
+        return summary;
+
+    std::sort(samples.begin(), samples.end());
+
+    double total = 0.0;
+    for (auto sample : samples)
+        total += sample;
+
+    summary.Min = samples.front();
+    summary.Median = GetPercentile(samples, 0.5);
+    summary.P99 = GetPercentile(samples, 0.99);
+    summary.Max = samples.back();
+    summary.Mean = total / samples.size();
+    return summary;
+}
+
+// Times the entity checksum reusing the data of unchanged entities against serialising all of them.
+static void BenchEntitiesChecksum(TimingSummary& cached, TimingSummary& full)
+{
+    constexpr int32_t Iterations = 20;
+
+    std::vector<double> cachedTimes;
+    std::vector<double> fullTimes;
+    GetAllEntitiesChecksum();
+    for (int32_t i = 0; i < Iterations; i++)
+    {
+        const auto cachedStart = std::chrono::high_resolution_clock::now();
+        GetAllEntitiesChecksum();
+        const auto fullStart = std::chrono::high_resolution_clock::now();
+        GetAllEntitiesChecksumFull();
+        const auto fullEnd = std::chrono::high_resolution_clock::now();
+        cachedTimes.push_back(std::chrono::duration<double, std::micro>(fullStart - cachedStart).count());
+        fullTimes.push_back(std::chrono::duration<double, std::micro>(fullEnd - fullStart).count());
+    }
+    cached = Summarise(cachedTimes);
+    full = Summarise(fullTimes);
+}
+
+static json_t SummaryToJson(const TimingSummary& summary)
+{
+    json_t jsonSummary;
+    jsonSummary["min"] = summary.Min;
+    jsonSummary["median"] = summary.Median;
+    jsonSummary["p99"] = summary.P99;
+    jsonSummary["max"] = summary.Max;
+    jsonSummary["mean"] = summary.Mean;
+    return jsonSummary;
+}
+
+static exitcode_t HandleBench(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 2)
+    {
+        Console::Error::WriteLine("Missing arguments <file> <ticks>.");
+        return EXITCODE_FAIL;
+    }
+
+    const char* inputPath = argv[0];
+    uint32_t ticks = atol(argv[1]);
+    uint32_t warmupTicks = static_cast<uint32_t>(std::max(_warmupTicks, 0));
+
+    if (ticks == 0)
+    {
+        Console::Error::WriteLine("Number of ticks must be greater than zero.");
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto* gameState = context->GetGameState();
+
+    Console::WriteLine("Warming up for %u ticks...", warmupTicks);
+    for (uint32_t i = 0; i < warmupTicks; i++)
+    {
+        gameState->UpdateLogic();
+    }
+
+    // Per-phase timings come from the profiler registry, every PROFILED_FUNCTION reached by the
+    // tick is measured. The totals are sampled around each tick to get the per tick durations.
+    Profiling::ResetData();
+    Profiling::Enable();
+
+    std::vector<FunctionTiming> functionTimings;
+    for (auto* func : Profiling::GetData())
+    {
+        functionTimings.push_back({ func, 0, 0.0, {} });
+    }
+    std::vector<double> tickTimes;
+    tickTimes.reserve(ticks);
+
+    const CacheCounters cacheCounters;
+    std::vector<double> tickCacheMisses;
+    CacheCounts totalCacheCounts;
+
+    Console::WriteLine("Running %u ticks...", ticks);
+    const auto benchStart = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        for (auto& timing : functionTimings)
+        {
+            timing.Calls = timing.Func->GetCallCount();
+            timing.Total = timing.Func->GetTotalTime();
+        }
+
+        const auto cacheStart = cacheCounters.Read();
+        const auto tickStart = std::chrono::high_resolution_clock::now();
+        gameState->UpdateLogic();
+        const auto tickEnd = std::chrono::high_resolution_clock::now();
+        const auto cacheEnd = cacheCounters.Read();
+        tickTimes.push_back(std::chrono::duration<double, std::micro>(tickEnd - tickStart).count());
+        tickCacheMisses.push_back(static_cast<double>(cacheEnd.Misses - cacheStart.Misses));
+        totalCacheCounts.References += cacheEnd.References - cacheStart.References;
+        totalCacheCounts.Misses += cacheEnd.Misses - cacheStart.Misses;
+
+        for (auto& timing : functionTimings)
+        {
+            if (timing.Func->GetCallCount() != timing.Calls)
+            {
+                timing.TickTimes.push_back(timing.Func->GetTotalTime() - timing.Total);
+            }
+        }
+    }
+    const auto benchEnd = std::chrono::high_resolution_clock::now();
+
+    Profiling::Disable();
+
+    const auto elapsedSeconds = std::chrono::duration<double>(benchEnd - benchStart).count();
+    const auto ticksPerSecond = ticks / elapsedSeconds;
+    const auto tickSummary = Summarise(tickTimes);
+    const auto cacheMissSummary = Summarise(tickCacheMisses);
+    const auto cacheMissRate = totalCacheCounts.References != 0
+        ? static_cast<double>(totalCacheCounts.Misses) / totalCacheCounts.References
+        : 0.0;
+    const auto checksum = GetAllEntitiesChecksum().ToString();
+
+    TimingSummary checksumCached;
+    TimingSummary checksumFull;
+    BenchEntitiesChecksum(checksumCached, checksumFull);
+
+    // Most expensive phases first.
+    functionTimings.erase(
+        std::remove_if(
+            functionTimings.begin(), functionTimings.end(), [](const FunctionTiming& timing) { return timing.TickTimes.empty(); }),
+        functionTimings.end());
+    std::sort(functionTimings.begin(), functionTimings.end(), [](const FunctionTiming& a, const FunctionTiming& b) {
+        return a.Func->GetTotalTime() > b.Func->GetTotalTime();
+    });
+
+    Console::WriteLine();
+    Console::WriteLine("Ticks per second: %.2f", ticksPerSecond);
+    Console::WriteLine(
+        "Tick (us): min %.1f, median %.1f, p99 %.1f, max %.1f", tickSummary.Min, tickSummary.Median, tickSummary.P99,
+        tickSummary.Max);
+    if (cacheCounters.IsAvailable())
+    {
+        Console::WriteLine(
+            "Cache misses per tick: min %.0f, median %.0f, p99 %.0f, max %.0f (%.2f%% of references)", cacheMissSummary.Min,
+            cacheMissSummary.Median, cacheMissSummary.P99, cacheMissSummary.Max, cacheMissRate * 100.0);
+    }
+    else
+    {
+        Console::WriteLine("Cache misses per tick: hardware counters not available");
+    }
+    Console::WriteLine();
+    Console::WriteLine("%12s %12s %12s %12s %8s  %s", "total (ms)", "min (us)", "median (us)", "p99 (us)", "ticks", "function");
+
+    json_t jsonFunctions = json_t::array();
+    for (const auto& timing : functionTimings)
+    {
+        const auto summary = Summarise(timing.TickTimes);
+        const auto totalTime = timing.Func->GetTotalTime();
+        Console::WriteLine(
+            "%12.2f %12.1f %12.1f %12.1f %8zu  %s", totalTime / 1000.0, summary.Min, summary.Median, summary.P99,
+            timing.TickTimes.size(), timing.Func->GetName());
+
+        json_t jsonFunction;
+        jsonFunction["name"] = timing.Func->GetName();
+        jsonFunction["calls"] = timing.Func->GetCallCount();
+        jsonFunction["ticks"] = timing.TickTimes.size();
+        jsonFunction["total"] = totalTime;
+        jsonFunction["perTick"] = SummaryToJson(summary);
+        jsonFunctions.push_back(jsonFunction);
+    }
+    Console::WriteLine();
+    Console::WriteLine(
+        "Entity checksum (us): median %.1f, full serialisation median %.1f", checksumCached.Median, checksumFull.Median);
+    Console::WriteLine("Completed: %s", checksum.c_str());
+
+    if (!_outputPath.empty())
+    {
+        json_t jsonResult;
+        jsonResult["park"] = inputPath;
+        jsonResult["warmupTicks"] = warmupTicks;
+        jsonResult["ticks"] = ticks;
+        jsonResult["elapsedSeconds"] = elapsedSeconds;
+        jsonResult["ticksPerSecond"] = ticksPerSecond;
+        jsonResult["checksum"] = checksum;
+        jsonResult["tick"] = SummaryToJson(tickSummary);
+        if (cacheCounters.IsAvailable())
+        {
+            jsonResult["cacheMisses"] = SummaryToJson(cacheMissSummary);
+            jsonResult["cacheReferences"] = totalCacheCounts.References;
+            jsonResult["cacheMissRate"] = cacheMissRate;
+        }
+        jsonResult["entitiesChecksum"] = SummaryToJson(checksumCached);
+        jsonResult["entitiesChecksumFull"] = SummaryToJson(checksumFull);
+        jsonResult["functions"] = jsonFunctions;
+
+        try
+        {
+            Json::WriteToFile(_outputPath, jsonResult);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write results to '%s': %s", _outputPath.c_str(), e.what());
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("Results written to %s", _outputPath.c_str());
+    }
+
+    return EXITCODE_OK;
+}
+
+// Returns the resident memory of the process, or nothing on platforms where that is not implemented.
+static std::optional<MemoryUsage> GetMemoryUsage()
+{
+#ifdef __linux__
+    auto* file = fopen("/proc/self/statm", "r");
+    if (file == nullptr)
+        return std::nullopt;
+
+    long size{};
+    long resident{};
+    long shared{};
+    const auto numRead = fscanf(file, "%ld %ld %ld", &size, &resident, &shared);
+    fclose(file);
+    if (numRead != 3)
+        return std::nullopt;
+
+    const auto pageSize = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    return MemoryUsage{ (resident - shared) * pageSize, shared * pageSize };
+#else
+    return std::nullopt;
+#endif
+}
+
+static bool LoadGraphics(const IPlatformEnvironment& env, bool memoryMapped)
+{
+    if (!GfxLoadG1(env, memoryMapped))
+        return false;
+
+    GfxLoadG2(memoryMapped);
+    GfxLoadCsg(memoryMapped);
+    return true;
+}
+
+static void UnloadGraphics()
+{
+    GfxUnloadCsg();
+    GfxUnloadG2();
+    GfxUnloadG1();
+}
+
+// Reads the data of every sprite, like drawing all of them once would.
+static uint32_t TouchAllSprites()
+{
+    uint32_t sum = 0;
+    for (ImageIndex image = 0; image < SPR_CSG_END; image++)
+    {
+        const auto* g1 = GfxGetG1Element(image);
+        if (g1 == nullptr || g1->offset == nullptr)
+            continue;
+
+        const auto dataSize = G1CalculateDataSize(g1);
+        for (size_t i = 0; i < dataSize; i++)
+        {
+            sum += g1->offset[i];
+        }
+    }
+    return sum;
+}
+
+static json_t MemoryUsageToJson(const std::optional<MemoryUsage>& usage)
+{
+    if (!usage.has_value())
+        return json_t();
+
+    return { { "private", usage->Private }, { "shared", usage->Shared } };
+}
+
+static exitcode_t HandleBenchGraphics(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    const int32_t iterations = argc >= 1 ? atol(argv[0]) : 10;
+    if (iterations <= 0)
+    {
+        Console::Error::WriteLine("Number of iterations must be greater than zero.");
+        return EXITCODE_FAIL;
+    }
+
+    // The context must not load the graphics itself, every load is timed below.
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    gOpenRCT2NoGraphics = false;
+
+    const auto& env = *context->GetPlatformEnvironment();
+
+    // Brings the files into the page cache, so both ways are measured with the same cache state.
+    if (!LoadGraphics(env, false))
+    {
+        Console::Error::WriteLine("Unable to load the graphics.");
+        return EXITCODE_FAIL;
+    }
+    UnloadGraphics();
+
+    json_t jsonModes = json_t::array();
+    Console::WriteLine(
+        "%-8s %12s %12s %12s %14s %14s %14s %14s", "mode", "min (ms)", "median (ms)", "max (ms)", "private (KiB)",
+        "shared (KiB)", "drawn private", "drawn shared");
+    for (const bool memoryMapped : { false, true })
+    {
+        std::vector<double> loadTimes;
+        std::optional<MemoryUsage> before;
+        std::optional<MemoryUsage> loaded;
+        std::optional<MemoryUsage> touched;
+        for (int32_t i = 0; i < iterations; i++)
+        {
+            before = GetMemoryUsage();
+            const auto loadStart = std::chrono::high_resolution_clock::now();
+            LoadGraphics(env, memoryMapped);
+            const auto loadEnd = std::chrono::high_resolution_clock::now();
+            loadTimes.push_back(std::chrono::duration<double, std::milli>(loadEnd - loadStart).count());
+
+            // Only the last load is kept around long enough to measure what the sprites cost once drawn.
+            if (i == iterations - 1)
+            {
+                loaded = GetMemoryUsage();
+                [[maybe_unused]] volatile auto sum = TouchAllSprites();
+                touched = GetMemoryUsage();
+            }
+            UnloadGraphics();
+        }
+
+        // Growth of the resident memory caused by the graphics
+        auto getGrowth = [&before](const std::optional<MemoryUsage>& usage) -> std::optional<MemoryUsage> {
+            if (!before.has_value() || !usage.has_value())
+                return std::nullopt;
+            return MemoryUsage{ usage->Private - before->Private, usage->Shared - before->Shared };
+        };
+        const auto loadedGrowth = getGrowth(loaded);
+        const auto touchedGrowth = getGrowth(touched);
+
+        const auto* modeName = memoryMapped ? "mapped" : "read";
+        const auto summary = Summarise(loadTimes);
+        if (loadedGrowth.has_value() && touchedGrowth.has_value())
+        {
+            Console::WriteLine(
+                "%-8s %12.2f %12.2f %12.2f %14" PRId64 " %14" PRId64 " %14" PRId64 " %14" PRId64, modeName, summary.Min,
+                summary.Median, summary.Max, loadedGrowth->Private / 1024, loadedGrowth->Shared / 1024,
+                touchedGrowth->Private / 1024, touchedGrowth->Shared / 1024);
+        }
+        else
+        {
+            Console::WriteLine("%-8s %12.2f %12.2f %12.2f", modeName, summary.Min, summary.Median, summary.Max);
+        }
+
+        json_t jsonMode;
+        jsonMode["mode"] = modeName;
+        jsonMode["load"] = SummaryToJson(summary);
+        jsonMode["memoryLoaded"] = MemoryUsageToJson(loadedGrowth);
+        jsonMode["memoryTouched"] = MemoryUsageToJson(touchedGrowth);
+        jsonModes.push_back(jsonMode);
+    }
+
+    if (!_outputPath.empty())
+    {
+        json_t jsonResult;
+        jsonResult["iterations"] = iterations;
+        jsonResult["modes"] = jsonModes;
+
+        try
+        {
+            Json::WriteToFile(_outputPath, jsonResult);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write results to '%s': %s", _outputPath.c_str(), e.what());
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("Results written to %s", _outputPath.c_str());
+    }
+
+    return EXITCODE_OK;
+}
+
+using BlitRLERunFunc = decltype(&BlitRLERunScalar);
+
+struct SpriteBenchData
+{
+    Drawing::ImageImporter::ImportResult Sprite;
+    uint8_t Remap[256]{};
+    std::vector<uint8_t> BlendMaps;
+    std::vector<uint8_t> Background;
+};
+
+// Builds a sprite with runs of varying length and colour, so the sprite drawing can be measured without the game data.
+static SpriteBenchData CreateSpriteBenchData()
+{
+    constexpr uint32_t SpriteSize = 128;
+    std::mt19937 random(1234);
+
+    Image image;
+    image.Width = SpriteSize;
+    image.Height = SpriteSize;
+    image.Depth = 32;
+    image.Stride = SpriteSize * 4;
+    image.Pixels.resize(image.Stride * SpriteSize);
+    for (uint32_t y = 0; y < SpriteSize; y++)
+    {
+        uint32_t x = 0;
+        while (x < SpriteSize)
+        {
+            const auto runLength = 1 + random() % 48;
+            const auto isTransparent = (random() % 3) == 0;
+            for (uint32_t i = 0; i < runLength && x < SpriteSize; i++, x++)
+            {
+                auto* pixel = &image.Pixels[y * image.Stride + x * 4];
+                pixel[0] = static_cast<uint8_t>(random());
+                pixel[1] = static_cast<uint8_t>(random());
+                pixel[2] = static_cast<uint8_t>(random());
+                pixel[3] = isTransparent ? 0 : 255;
+            }
+        }
+    }
+
+    SpriteBenchData data;
+    Drawing::ImageImporter importer;
+    data.Sprite = importer.Import(
+        image, 0, 0, Drawing::ImageImporter::Palette::OpenRCT2, Drawing::ImageImporter::ImportFlags::RLE);
+    for (auto& entry : data.Remap)
+    {
+        entry = static_cast<uint8_t>(random());
+    }
+    data.BlendMaps.resize(255 * 256);
+    for (auto& entry : data.BlendMaps)
+    {
+        entry = static_cast<uint8_t>(random());
+    }
+    data.Background.resize(SpriteSize * SpriteSize);
+    for (auto& pixel : data.Background)
+    {
+        pixel = static_cast<uint8_t>(random());
+    }
+    return data;
+}
+
+// Draws every run of the sprite with the given kernel, skipping the source pixels a zoom level leaves out.
+static void DrawRLESprite(
+    const G1Element& element, BlitRLERunFunc blit, DrawBlendOp blendOp, int32_t zoomLevel, const PaletteMap& paletteMap,
+    uint8_t* dst)
+{
+    const auto zoom = 1 << zoomLevel;
+    for (int32_t y = 0; y < element.height; y += zoom)
+    {
+        const uint16_t lineOffset = element.offset[y * 2] | (element.offset[y * 2 + 1] << 8);
+        const uint8_t* nextRun = element.offset + lineOffset;
+        auto* dstLine = dst + static_cast<size_t>(element.width) * (y >> zoomLevel);
+        auto isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            const auto* src = nextRun;
+            uint8_t dataSize = *src++;
+            int32_t x = *src++;
+            isEndOfLine = (dataSize & 0x80) != 0;
+            dataSize &= 0x7F;
+            nextRun = src + dataSize;
+
+            int32_t numPixels = dataSize;
+            auto mod = x & (zoom - 1);
+            if (mod != 0)
+            {
+                x += zoom - mod;
+                src += zoom - mod;
+                numPixels -= zoom - mod;
+            }
+            blit(src, dstLine + (x >> zoomLevel), numPixels, zoomLevel, blendOp, paletteMap);
+        }
+    }
+}
+
+static json_t BenchRLEKernels(SpriteBenchData& data, int32_t iterations)
+{
+    static constexpr DrawBlendOp BlendOps[] = {
+        BLEND_TRANSPARENT,
+        BLEND_TRANSPARENT | BLEND_SRC,
+        BLEND_TRANSPARENT | BLEND_DST,
+        BLEND_TRANSPARENT | BLEND_SRC | BLEND_DST,
+    };
+
+    std::vector<std::pair<const char*, BlitRLERunFunc>> kernels;
+    kernels.emplace_back("scalar", BlitRLERunScalar);
+    if (SSE41Available())
+    {
+        kernels.emplace_back("sse4.1", BlitRLERunSse4_1);
+    }
+    if (AVX2Available())
+    {
+        kernels.emplace_back("avx2", BlitRLERunAvx2);
+    }
+
+    Console::WriteLine("RLE run kernels, time per sprite drawn:");
+    Console::WriteLine("%-8s %6s %12s %12s %12s", "kernel", "zoom", "min (us)", "median (us)", "p99 (us)");
+    json_t jsonKernels = json_t::array();
+    for (const auto& [name, blit] : kernels)
+    {
+        for (int32_t zoomLevel = 0; zoomLevel <= 3; zoomLevel++)
+        {
+            std::vector<double> drawTimes;
+            for (int32_t i = 0; i < iterations; i++)
+            {
+                for (auto blendOp : BlendOps)
+                {
+                    const auto paletteMap = (blendOp & BLEND_SRC) != 0 && (blendOp & BLEND_DST) != 0
+                        ? PaletteMap(data.BlendMaps.data(), 255, 256)
+                        : PaletteMap(data.Remap);
+                    const auto drawStart = std::chrono::high_resolution_clock::now();
+                    DrawRLESprite(data.Sprite.Element, blit, blendOp, zoomLevel, paletteMap, data.Background.data());
+                    const auto drawEnd = std::chrono::high_resolution_clock::now();
+                    drawTimes.push_back(std::chrono::duration<double, std::micro>(drawEnd - drawStart).count());
+                }
+            }
+
+            const auto summary = Summarise(drawTimes);
+            Console::WriteLine("%-8s %6d %12.2f %12.2f %12.2f", name, zoomLevel, summary.Min, summary.Median, summary.P99);
+
+            json_t jsonKernel;
+            jsonKernel["kernel"] = name;
+            jsonKernel["zoomLevel"] = zoomLevel;
+            jsonKernel["draw"] = SummaryToJson(summary);
+            jsonKernels.push_back(jsonKernel);
+        }
+    }
+    return jsonKernels;
+}
+
+static std::optional<json_t> BenchSpriteCache(SpriteBenchData& data, int32_t iterations)
+{
+    const auto baseImage = GfxObjectAllocateImages(&data.Sprite.Element, 1);
+    if (baseImage == ImageIndexUndefined)
+    {
+        return std::nullopt;
+    }
+
+    const auto imageId = ImageId(baseImage, COLOUR_BRIGHT_RED, COLOUR_DARK_GREEN);
+    const auto width = data.Sprite.Element.width;
+    const auto height = data.Sprite.Element.height;
+    Drawing::X8SpriteCache cache;
+
+    Console::WriteLine("Sprite cache, time per sprite drawn:");
+    Console::WriteLine("%6s %12s %12s %12s %12s", "zoom", "decoded (us)", "p99 (us)", "cached (us)", "p99 (us)");
+    json_t jsonZoomLevels = json_t::array();
+    for (int8_t level = 0; level <= 2; level++)
+    {
+        const ZoomLevel zoomLevel{ level };
+        DrawPixelInfo dpi{};
+        dpi.bits = data.Background.data();
+        dpi.width = zoomLevel.ApplyTo(width);
+        dpi.height = zoomLevel.ApplyTo(height);
+        dpi.zoom_level = zoomLevel;
+        dpi.pitch = width - zoomLevel.ApplyInversedTo(dpi.width);
+
+        std::vector<double> decodedTimes;
+        std::vector<double> cachedTimes;
+        for (int32_t i = 0; i < iterations; i++)
+        {
+            auto drawStart = std::chrono::high_resolution_clock::now();
+            GfxDrawSpriteSoftware(dpi, imageId, { 0, 0 });
+            auto drawEnd = std::chrono::high_resolution_clock::now();
+            decodedTimes.push_back(std::chrono::duration<double, std::micro>(drawEnd - drawStart).count());
+
+            drawStart = std::chrono::high_resolution_clock::now();
+            cache.Draw(dpi, imageId, { 0, 0 });
+            drawEnd = std::chrono::high_resolution_clock::now();
+            cachedTimes.push_back(std::chrono::duration<double, std::micro>(drawEnd - drawStart).count());
+        }
+
+        const auto decoded = Summarise(decodedTimes);
+        const auto cached = Summarise(cachedTimes);
+        Console::WriteLine("%6d %12.2f %12.2f %12.2f %12.2f", level, decoded.Median, decoded.P99, cached.Median, cached.P99);
+
+        json_t jsonZoomLevel;
+        jsonZoomLevel["zoomLevel"] = level;
+        jsonZoomLevel["decoded"] = SummaryToJson(decoded);
+        jsonZoomLevel["cached"] = SummaryToJson(cached);
+        jsonZoomLevels.push_back(jsonZoomLevel);
+    }
+
+    GfxObjectFreeImages(baseImage, 1);
+    return jsonZoomLevels;
+}
+
+static exitcode_t HandleBenchSprites(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    const int32_t iterations = argc >= 1 ? atol(argv[0]) : 200;
+    if (iterations <= 0)
+    {
+        Console::Error::WriteLine("Number of iterations must be greater than zero.");
+        return EXITCODE_FAIL;
+    }
+
+    auto data = CreateSpriteBenchData();
+    auto jsonKernels = BenchRLEKernels(data, iterations);
+    Console::WriteLine();
+    auto jsonSpriteCache = BenchSpriteCache(data, iterations);
+    if (!jsonSpriteCache.has_value())
+    {
+        Console::Error::WriteLine("Unable to allocate the sprite for the sprite cache.");
+        return EXITCODE_FAIL;
+    }
+
+    if (!_outputPath.empty())
+    {
+        json_t jsonResult;
+        jsonResult["iterations"] = iterations;
+        jsonResult["rleKernels"] = jsonKernels;
+        jsonResult["spriteCache"] = *jsonSpriteCache;
+
+        try
+        {
+            Json::WriteToFile(_outputPath, jsonResult);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write results to '%s': %s", _outputPath.c_str(), e.what());
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("Results written to %s", _outputPath.c_str());
+    }
+
+    return EXITCODE_OK;
+}
+
+static json_t BenchEntityLists(int32_t numEntities)
+{
+    constexpr int32_t NumRounds = 1000;
+    constexpr int32_t NumChurnsPerRound = 20;
+
+    std::vector<EntityId> ids;
+    for (int32_t i = 0; i < numEntities; i++)
+    {
+        auto* guest = CreateEntity<Guest>();
+        if (guest == nullptr)
+        {
+            break;
+        }
+        guest->x = i;
+        ids.push_back(guest->Id);
+    }
+
+    // The previous container for comparison, filled in the order guests would have spawned and left in a running
+    // park, which leaves the nodes scattered over the heap.
+    std::mt19937 random(1234);
+    std::shuffle(ids.begin(), ids.end(), random);
+    std::list<EntityId> list;
+    for (auto id : ids)
+    {
+        list.insert(std::lower_bound(list.begin(), list.end(), id), id);
+    }
+    EntityIdSet set;
+    for (auto id : ids)
+    {
+        set.Insert(id);
+    }
+
+    // Guests leaving the park and new ones spawning.
+    std::vector<double> listChurnTimes;
+    std::vector<double> setChurnTimes;
+    for (int32_t round = 0; round < NumRounds; round++)
+    {
+        EntityId churnIds[NumChurnsPerRound];
+        for (auto& id : churnIds)
+        {
+            id = ids[random() % ids.size()];
+        }
+
+        const auto listStart = std::chrono::high_resolution_clock::now();
+        for (auto id : churnIds)
+        {
+            list.erase(std::lower_bound(list.begin(), list.end(), id));
+            list.insert(std::lower_bound(list.begin(), list.end(), id), id);
+        }
+        const auto setStart = std::chrono::high_resolution_clock::now();
+        for (auto id : churnIds)
+        {
+            set.Remove(id);
+            set.Insert(id);
+        }
+        const auto setEnd = std::chrono::high_resolution_clock::now();
+        listChurnTimes.push_back(std::chrono::duration<double, std::micro>(setStart - listStart).count());
+        setChurnTimes.push_back(std::chrono::duration<double, std::micro>(setEnd - setStart).count());
+    }
+
+    std::vector<double> listIterateTimes;
+    std::vector<double> setIterateTimes;
+    int64_t listSum = 0;
+    int64_t setSum = 0;
+    for (int32_t round = 0; round < NumRounds; round++)
+    {
+        const auto listStart = std::chrono::high_resolution_clock::now();
+        for (auto id : list)
+        {
+            auto* guest = GetEntity<Guest>(id);
+            if (guest != nullptr)
+            {
+                listSum += guest->x;
+            }
+        }
+        const auto setStart = std::chrono::high_resolution_clock::now();
+        for (auto* guest : EntityList<Guest>())
+        {
+            setSum += guest->x;
+        }
+        const auto setEnd = std::chrono::high_resolution_clock::now();
+        listIterateTimes.push_back(std::chrono::duration<double, std::micro>(setStart - listStart).count());
+        setIterateTimes.push_back(std::chrono::duration<double, std::micro>(setEnd - setStart).count());
+    }
+    ResetAllEntities();
+    [[maybe_unused]] volatile auto sum = listSum + setSum;
+
+    Console::WriteLine(
+        "Guest list with %zu guests, every churn removes and inserts %d of them:", ids.size(), NumChurnsPerRound);
+    Console::WriteLine("%-20s %12s %12s %12s", "operation", "min (us)", "median (us)", "p99 (us)");
+    json_t jsonLists = json_t::array();
+    const std::pair<const char*, const std::vector<double>&> timings[] = {
+        { "list churn", listChurnTimes },
+        { "id set churn", setChurnTimes },
+        { "list iterate", listIterateTimes },
+        { "id set iterate", setIterateTimes },
+    };
+    for (const auto& [name, times] : timings)
+    {
+        const auto summary = Summarise(times);
+        Console::WriteLine("%-20s %12.2f %12.2f %12.2f", name, summary.Min, summary.Median, summary.P99);
+
+        json_t jsonTiming = SummaryToJson(summary);
+        jsonTiming["operation"] = name;
+        jsonLists.push_back(jsonTiming);
+    }
+    return jsonLists;
+}
+
+static json_t BenchEntityQueries(int32_t numEntities)
+{
+    constexpr int32_t NumQueries = 2000;
+    constexpr int32_t MapSize = 256 * COORDS_XY_STEP;
+    constexpr int32_t MaxDistance = 3 * COORDS_XY_STEP;
+
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int32_t> randomCoord(0, MapSize - 1);
+    for (int32_t i = 0; i < numEntities; i++)
+    {
+        auto* litter = CreateEntity<Litter>();
+        if (litter == nullptr)
+        {
+            break;
+        }
+        litter->MoveTo({ randomCoord(random), randomCoord(random), 0 });
+    }
+
+    // Only a part of the entities match, like when looking for one type of litter.
+    const auto isMatch = [](const Litter* litter) { return litter->Id.ToUnderlying() % 3 != 0; };
+
+    std::vector<double> linearTimes;
+    std::vector<double> indexedTimes;
+    size_t numFound = 0;
+    for (int32_t i = 0; i < NumQueries; i++)
+    {
+        const CoordsXY loc{ randomCoord(random), randomCoord(random) };
+        const auto getDistance = [&loc](const Litter* litter) {
+            return std::abs(litter->x - loc.x) + std::abs(litter->y - loc.y);
+        };
+
+        const auto linearStart = std::chrono::high_resolution_clock::now();
+        const Litter* nearestLinear = nullptr;
+        auto nearestDistance = MaxDistance + 1;
+        for (auto* litter : EntityList<Litter>())
+        {
+            if (isMatch(litter) && getDistance(litter) < nearestDistance)
+            {
+                nearestLinear = litter;
+                nearestDistance = getDistance(litter);
+            }
+        }
+        const auto indexedStart = std::chrono::high_resolution_clock::now();
+        const auto* nearestIndexed = GetNearestEntity<Litter>(loc, MaxDistance, getDistance, isMatch);
+        const auto indexedEnd = std::chrono::high_resolution_clock::now();
+
+        linearTimes.push_back(std::chrono::duration<double, std::micro>(indexedStart - linearStart).count());
+        indexedTimes.push_back(std::chrono::duration<double, std::micro>(indexedEnd - indexedStart).count());
+        numFound += (nearestLinear != nullptr ? 1 : 0) + (nearestIndexed != nullptr ? 1 : 0);
+    }
+    ResetAllEntities();
+
+    const auto linear = Summarise(linearTimes);
+    const auto indexed = Summarise(indexedTimes);
+    Console::WriteLine("Nearest litter within %d tiles, %d queries:", MaxDistance / COORDS_XY_STEP, NumQueries);
+    Console::WriteLine("%-8s %12s %12s %12s", "query", "min (us)", "median (us)", "p99 (us)");
+    Console::WriteLine("%-8s %12.2f %12.2f %12.2f", "linear", linear.Min, linear.Median, linear.P99);
+    Console::WriteLine("%-8s %12.2f %12.2f %12.2f", "indexed", indexed.Min, indexed.Median, indexed.P99);
+    Console::WriteLine("Found: %zu of %d", numFound / 2, NumQueries);
+
+    json_t jsonQueries;
+    jsonQueries["queries"] = NumQueries;
+    jsonQueries["linear"] = SummaryToJson(linear);
+    jsonQueries["indexed"] = SummaryToJson(indexed);
+    return jsonQueries;
+}
+
+static exitcode_t HandleBenchEntities(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    const int32_t numEntities = argc >= 1 ? atol(argv[0]) : 10000;
+    if (numEntities <= 0 || numEntities >= MAX_ENTITIES)
+    {
+        Console::Error::WriteLine("Number of entities must be between 1 and %d.", MAX_ENTITIES - 1);
+        return EXITCODE_FAIL;
+    }
+
+    ResetAllEntities();
+    auto jsonLists = BenchEntityLists(numEntities);
+    Console::WriteLine();
+    auto jsonQueries = BenchEntityQueries(numEntities);
+
+    if (!_outputPath.empty())
+    {
+        json_t jsonResult;
+        jsonResult["entities"] = numEntities;
+        jsonResult["guestList"] = jsonLists;
+        jsonResult["nearestQueries"] = jsonQueries;
+
+        try
+        {
+            Json::WriteToFile(_outputPath, jsonResult);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write results to '%s': %s", _outputPath.c_str(), e.what());
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("Results written to %s", _outputPath.c_str());
+    }
+
+    return EXITCODE_OK;
+}
+
+#ifndef DISABLE_NETWORK
+
+using SimulatedClients = std::vector<std::unique_ptr<NetworkSimulatedClient>>;
+
+// Updates the server and the simulated clients until the condition is met, returns false if it timed out.
+template<typename TCondition>
+static bool UpdateNetworkUntil(NetworkBase& network, SimulatedClients& clients, uint32_t timeout, TCondition&& condition)
+{
+    const auto endTime = Platform::GetTicks() + timeout;
+    while (!condition())
+    {
+        if (Platform::GetTicks() >= endTime)
+            return false;
+
+        network.Update();
+        network.ProcessPending();
+        network.Flush();
+        for (auto& client : clients)
+        {
+            client->Update();
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+static bool ServerReceivedGameActions(NetworkBase& network, const SimulatedClients& clients)
+{
+    constexpr auto Commands = EnumValue(NetworkStatisticsGroup::Commands);
+    for (const auto& client : clients)
+    {
+        if (client->GetState() != NetworkSimulatedClient::State::Joined)
+            continue;
+
+        const auto* connection = network.GetPlayerConnection(client->GetPlayerId());
+        if (connection == nullptr)
+            continue;
+
+        if (client->GetOutboundQueueSize() != 0
+            || connection->Stats.bytesReceived[Commands] < client->GetStats().bytesSent[Commands])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static const char* GetClientStateName(NetworkSimulatedClient::State state)
+{
+    switch (state)
+    {
+        case NetworkSimulatedClient::State::Connecting:
+            return "connecting";
+        case NetworkSimulatedClient::State::Authenticating:
+            return "authenticating";
+        case NetworkSimulatedClient::State::DownloadingMap:
+            return "downloading map";
+        case NetworkSimulatedClient::State::Joined:
+            return "joined";
+        default:
+            return "disconnected";
+    }
+}
+
+static exitcode_t HandleBenchNetwork(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing argument <park or parkrep>.");
+        return EXITCODE_FAIL;
+    }
+
+    const char* inputPath = argv[0];
+    uint32_t ticks = argc >= 2 ? atol(argv[1]) : 0;
+    const auto numClients = static_cast<uint32_t>(std::clamp(_networkClients, 1, 254));
+    const auto port = static_cast<uint16_t>(std::clamp(_networkPort, 1, 65535));
+    const bool isReplay = String::IEquals(Path::GetExtension(inputPath), ".parkrep");
+
+    if (ticks == 0 && !isReplay)
+    {
+        Console::Error::WriteLine("Number of ticks must be greater than zero.");
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // Everything stays on this machine, the server is not advertised and accepts all simulated clients.
+    gConfigNetwork.Advertise = false;
+    gConfigNetwork.KnownKeysOnly = false;
+    gConfigNetwork.Maxplayers = std::max<int32_t>(gConfigNetwork.Maxplayers, numClients + 1);
+
+    auto* replayManager = context->GetReplayManager();
+    std::vector<std::pair<uint32_t, std::unique_ptr<GameAction>>> actions;
+    if (isReplay)
+    {
+        if (!replayManager->StartPlayback(inputPath))
+        {
+            Console::Error::WriteLine("Unable to start replay '%s'.", inputPath);
+            return EXITCODE_FAIL;
+        }
+
+        ReplayRecordInfo info;
+        replayManager->GetCurrentReplayInfo(info);
+        if (ticks == 0)
+        {
+            ticks = info.Ticks;
+        }
+
+        // The clients send the recorded actions, the playback only compares the game state with the recorded checksums.
+        actions = replayManager->TakePlaybackActions();
+    }
+    else if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto& network = context->GetNetwork();
+    if (!network.BeginServer(port, "127.0.0.1"))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    // Clients join the admin group so that none of the replayed actions are denied.
+    network.SetDefaultGroup(0);
+
+    NetworkKey key;
+    if (!key.Generate())
+    {
+        Console::Error::WriteLine("Unable to generate a key for the clients.");
+        return EXITCODE_FAIL;
+    }
+    const auto publicKey = key.PublicKeyString();
+
+    Console::WriteLine("Connecting %u clients...", numClients);
+    SimulatedClients clients;
+    for (uint32_t i = 0; i < numClients; i++)
+    {
+        auto client = std::make_unique<NetworkSimulatedClient>("Client " + std::to_string(i + 1), key, publicKey);
+        client->Connect("127.0.0.1", port);
+        clients.push_back(std::move(client));
+    }
+
+    constexpr uint32_t JoinTimeout = 60000;
+    UpdateNetworkUntil(network, clients, JoinTimeout, [&clients]() {
+        return std::all_of(clients.begin(), clients.end(), [](const auto& client) {
+            return client->GetState() == NetworkSimulatedClient::State::Joined
+                || client->GetState() == NetworkSimulatedClient::State::Disconnected;
+        });
+    });
+
+    std::vector<double> joinTimes;
+    uint32_t mapSize = 0;
+    for (const auto& client : clients)
+    {
+        if (client->GetState() == NetworkSimulatedClient::State::Joined)
+        {
+            joinTimes.push_back(client->GetJoinTime());
+            mapSize = client->GetMapSize();
+        }
+    }
+    if (joinTimes.empty())
+    {
+        Console::Error::WriteLine("None of the clients was able to join.");
+        return EXITCODE_FAIL;
+    }
+    const auto joinSummary = Summarise(joinTimes);
+
+    std::vector<NetworkStats> statsBefore;
+    for (const auto& client : clients)
+    {
+        statsBefore.push_back(client->GetStats());
+    }
+
+    auto* gameState = context->GetGameState();
+    std::vector<double> tickTimes;
+    tickTimes.reserve(ticks);
+    size_t nextAction = 0;
+    size_t nextClient = 0;
+    uint32_t actionsSent = 0;
+    size_t maxQueueDepth = 0;
+    uint64_t totalQueueDepth = 0;
+    uint64_t queueDepthSamples = 0;
+    std::optional<uint32_t> desyncTick;
+
+    Console::WriteLine("Running %u ticks...", ticks);
+    const auto benchStart = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        // Spread the actions recorded for this tick over the clients.
+        bool sentActions = false;
+        while (nextAction < actions.size() && actions[nextAction].first <= gCurrentTicks)
+        {
+            for (size_t attempt = 0; attempt < clients.size(); attempt++)
+            {
+                auto& client = *clients[nextClient++ % clients.size()];
+                if (client.GetState() == NetworkSimulatedClient::State::Joined)
+                {
+                    client.SendGameAction(gCurrentTicks, *actions[nextAction].second);
+                    actionsSent++;
+                    sentActions = true;
+                    break;
+                }
+            }
+            nextAction++;
+        }
+
+        // Wait for the server to receive the actions so that they run on the tick they were recorded on.
+        if (sentActions)
+        {
+            constexpr uint32_t ActionTimeout = 5000;
+            UpdateNetworkUntil(
+                network, clients, ActionTimeout, [&network, &clients]() { return ServerReceivedGameActions(network, clients); });
+            GameActions::ProcessQueue();
+        }
+
+        const auto tickStart = std::chrono::high_resolution_clock::now();
+        gameState->UpdateLogic();
+        const auto tickEnd = std::chrono::high_resolution_clock::now();
+        tickTimes.push_back(std::chrono::duration<double, std::micro>(tickEnd - tickStart).count());
+
+        for (auto& client : clients)
+        {
+            client->Update();
+            if (client->GetState() != NetworkSimulatedClient::State::Joined)
+                continue;
+
+            const auto* connection = network.GetPlayerConnection(client->GetPlayerId());
+            if (connection != nullptr)
+            {
+                const auto queueDepth = connection->GetOutboundQueueSize();
+                maxQueueDepth = std::max(maxQueueDepth, queueDepth);
+                totalQueueDepth += queueDepth;
+                queueDepthSamples++;
+            }
+        }
+
+        if (isReplay && !desyncTick.has_value() && replayManager->IsPlaybackStateMismatching())
+        {
+            desyncTick = gCurrentTicks - 1;
+            Console::Error::WriteLine("Desync detected at tick %u.", *desyncTick);
+        }
+    }
+    const auto benchEnd = std::chrono::high_resolution_clock::now();
+
+    const auto elapsedSeconds = std::chrono::duration<double>(benchEnd - benchStart).count();
+    const auto ticksPerSecond = ticks / elapsedSeconds;
+    const auto tickSummary = Summarise(tickTimes);
+    const auto meanQueueDepth = queueDepthSamples != 0 ? static_cast<double>(totalQueueDepth) / queueDepthSamples : 0.0;
+    const auto mapSaveTime = network.GetStats().mapSaveTime;
+
+    Console::WriteLine();
+    Console::WriteLine(
+        "Clients joined: %zu/%u, join time (ms): median %.0f, max %.0f, map %u bytes saved in %u ms", joinTimes.size(),
+        numClients, joinSummary.Median, joinSummary.Max, mapSize, mapSaveTime);
+    Console::WriteLine("Ticks per second: %.2f", ticksPerSecond);
+    Console::WriteLine(
+        "Server tick (us): min %.1f, median %.1f, p99 %.1f, max %.1f", tickSummary.Min, tickSummary.Median, tickSummary.P99,
+        tickSummary.Max);
+    Console::WriteLine("Server outbound queue (packets): mean %.2f, max %zu", meanQueueDepth, maxQueueDepth);
+    if (isReplay)
+    {
+        Console::WriteLine("Game actions sent: %u of %zu", actionsSent, actions.size());
+        if (desyncTick.has_value())
+            Console::WriteLine("Desync: first at tick %u", *desyncTick);
+        else
+            Console::WriteLine("Desync: none");
+    }
+    Console::WriteLine();
+    Console::WriteLine(
+        "%-12s %14s %14s %8s %8s %6s  %s", "client", "sent (B/s)", "received (B/s)", "queue", "actions", "errors", "state");
+
+    json_t jsonClients = json_t::array();
+    constexpr auto Total = EnumValue(NetworkStatisticsGroup::Total);
+    for (size_t i = 0; i < clients.size(); i++)
+    {
+        const auto& client = *clients[i];
+        const auto& stats = client.GetStats();
+        const auto sentPerSecond = (stats.bytesSent[Total] - statsBefore[i].bytesSent[Total]) / elapsedSeconds;
+        const auto receivedPerSecond = (stats.bytesReceived[Total] - statsBefore[i].bytesReceived[Total]) / elapsedSeconds;
+        const auto* stateName = GetClientStateName(client.GetState());
+        Console::WriteLine(
+            "%-12s %14.0f %14.0f %8zu %8u %6u  %s %s", client.GetName().c_str(), sentPerSecond, receivedPerSecond,
+            client.GetOutboundQueueSize(), client.GetGameActionsReceived(), client.GetErrorsReceived(), stateName,
+            client.GetDisconnectReason().c_str());
+
+        json_t jsonClient;
+        jsonClient["name"] = client.GetName();
+        jsonClient["state"] = stateName;
+        jsonClient["disconnectReason"] = client.GetDisconnectReason();
+        jsonClient["joinTime"] = client.GetJoinTime();
+        jsonClient["bytesSentPerSecond"] = sentPerSecond;
+        jsonClient["bytesReceivedPerSecond"] = receivedPerSecond;
+        jsonClient["gameActionsReceived"] = client.GetGameActionsReceived();
+        jsonClient["errorsReceived"] = client.GetErrorsReceived();
+        jsonClients.push_back(jsonClient);
+    }
+
+    for (auto& client : clients)
+    {
+        client->Disconnect();
+    }
+    network.Close();
+
+    if (!_outputPath.empty())
+    {
+        json_t jsonResult;
+        jsonResult["park"] = inputPath;
+        jsonResult["clients"] = numClients;
+        jsonResult["clientsJoined"] = joinTimes.size();
+        jsonResult["joinTime"] = SummaryToJson(joinSummary);
+        jsonResult["mapSize"] = mapSize;
+        jsonResult["mapSaveTime"] = mapSaveTime;
+        jsonResult["ticks"] = ticks;
+        jsonResult["elapsedSeconds"] = elapsedSeconds;
+        jsonResult["ticksPerSecond"] = ticksPerSecond;
+        jsonResult["tick"] = SummaryToJson(tickSummary);
+        jsonResult["queueDepth"] = { { "mean", meanQueueDepth }, { "max", maxQueueDepth } };
+        jsonResult["gameActionsSent"] = actionsSent;
+        jsonResult["desyncTick"] = desyncTick.has_value() ? json_t(*desyncTick) : json_t();
+        jsonResult["clientResults"] = jsonClients;
+
+        try
+        {
+            Json::WriteToFile(_outputPath, jsonResult);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write results to '%s': %s", _outputPath.c_str(), e.what());
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("Results written to %s", _outputPath.c_str());
+    }
+
+    return EXITCODE_OK;
+}
+
+#endif // DISABLE_NETWORK
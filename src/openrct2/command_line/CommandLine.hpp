@@ -118,6 +118,7 @@ namespace CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand SimulateCommands[];
     extern const CommandLineCommand ParkInfoCommands[];
+    extern const CommandLineCommand BenchCommands[];
 
     extern const CommandLineExample RootExamples[];
 
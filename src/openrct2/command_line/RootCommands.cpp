@@ -142,6 +142,7 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
     DefineSubCommand("parkinfo",        CommandLine::ParkInfoCommands         ),
+    DefineSubCommand("bench",           CommandLine::BenchCommands            ),
     CommandTableEnd
 };
 
@@ -29,12 +29,14 @@ static constexpr CommandLineOptionDefinition ScreenshotOptionsDef[]
 };
 
 static exitcode_t HandleScreenshot(CommandLineArgEnumerator *argEnumerator);
+static exitcode_t HandleScreenshotServe(CommandLineArgEnumerator *argEnumerator);
 
 const CommandLineCommand CommandLine::ScreenshotCommands[]
 {
     // Main commands
     DefineCommand("", "<file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]", ScreenshotOptionsDef, HandleScreenshot),
     DefineCommand("", "<file> <output_image> giant <zoom> <rotation>",                      ScreenshotOptionsDef, HandleScreenshot),
+    DefineCommand("serve", "[<jobs_file>]",                                                  ScreenshotOptionsDef, HandleScreenshotServe),
     CommandTableEnd
 };
 // clang-format on
@@ -50,3 +52,18 @@ static exitcode_t HandleScreenshot(CommandLineArgEnumerator* argEnumerator)
     }
     return EXITCODE_OK;
 }
+
+static exitcode_t HandleScreenshotServe(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    // Jobs are read from stdin unless a file (or named pipe) is given, options are at the end of the command
+    const char* jobsPath = argc >= 1 && argv[0][0] != '-' ? argv[0] : nullptr;
+    int32_t result = CommandLineForScreenshotServer(jobsPath, &_options);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
@@ -207,6 +207,7 @@ namespace Config
 #else
             model->MultiThreading = reader->GetBoolean("multithreading", true);
 #endif // _DEBUG
+            model->BucketedPaintSort = reader->GetBoolean("bucketed_paint_sort", false);
             model->TrapCursor = reader->GetBoolean("trap_cursor", false);
             model->AutoOpenShops = reader->GetBoolean("auto_open_shops", false);
             model->ScenarioSelectMode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -292,6 +293,7 @@ namespace Config
         writer->WriteFloat("window_scale", model->WindowScale);
         writer->WriteBoolean("show_fps", model->ShowFPS);
         writer->WriteBoolean("multithreading", model->MultiThreading);
+        writer->WriteBoolean("bucketed_paint_sort", model->BucketedPaintSort);
         writer->WriteBoolean("trap_cursor", model->TrapCursor);
         writer->WriteBoolean("auto_open_shops", model->AutoOpenShops);
         writer->WriteInt32("scenario_select_mode", model->ScenarioSelectMode);
@@ -43,6 +43,7 @@ struct GeneralConfiguration
     bool UseVSync;
     bool ShowFPS;
     bool MultiThreading;
+    bool BucketedPaintSort;
     bool MinimizeFullscreenFocusLoss;
     bool DisableScreensaver;
 
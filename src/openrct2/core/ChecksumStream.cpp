@@ -40,6 +40,21 @@ namespace OpenRCT2
 
             *hash ^= temp;
             *hash *= Prime;
+
+            if (_recordedWords != nullptr)
+            {
+                _recordedWords->push_back(temp);
+            }
+        }
+    }
+
+    void ChecksumStream::WriteWords(const std::vector<uint64_t>& words)
+    {
+        uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
+        for (auto word : words)
+        {
+            *hash ^= word;
+            *hash *= Prime;
         }
     }
 
@@ -13,6 +13,7 @@
 #include "IStream.hpp"
 
 #include <array>
+#include <vector>
 
 namespace OpenRCT2
 {
@@ -23,6 +24,7 @@ namespace OpenRCT2
     {
         // FIXME: Move the checksum implementation out.
         std::array<std::byte, 20>& _checksum;
+        std::vector<uint64_t>* _recordedWords{};
 
         static constexpr uint64_t Seed = 0xcbf29ce484222325ULL;
         static constexpr uint64_t Prime = 0x00000100000001B3ULL;
@@ -32,6 +34,17 @@ namespace OpenRCT2
 
         virtual ~ChecksumStream() = default;
 
+        /**
+         * Appends every word that is hashed from now on to the given vector, pass nullptr to stop.
+         * Hashing the recorded words with WriteWords gives the same checksum as writing the data again.
+         */
+        void SetRecordedWords(std::vector<uint64_t>* words)
+        {
+            _recordedWords = words;
+        }
+
+        void WriteWords(const std::vector<uint64_t>& words);
+
         const void* GetData() const override
         {
             return _checksum.data();
@@ -9,21 +9,26 @@
 
 #include "JobPool.h"
 
-#include <algorithm>
 #include <cassert>
+#include <optional>
 
-JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
-    : WorkFn(workFn)
-    , CompletionFn(completionFn)
-{
-}
+// Identifies the pool and queue owned by the current worker thread.
+static thread_local const JobPool* _workerPool = nullptr;
+static thread_local size_t _workerQueueIndex = 0;
 
 JobPool::JobPool(size_t maxThreads)
 {
     maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
+
+    // There is always at least one queue so that tasks can be run by Join without any workers.
+    const auto numQueues = std::max<size_t>(maxThreads, 1);
+    for (size_t n = 0; n < numQueues; n++)
+    {
+        _queues.push_back(std::make_unique<WorkQueue>());
+    }
     for (size_t n = 0; n < maxThreads; n++)
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        _threads.emplace_back(&JobPool::ProcessQueue, this, n);
     }
 }
 
@@ -42,85 +47,149 @@ JobPool::~JobPool()
     }
 }
 
-void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
+void JobPool::AddTask(Task&& task)
 {
+    const auto queueIndex = GetCurrentQueueIndex();
+    {
+        auto& queue = *_queues[queueIndex];
+        std::scoped_lock lock(queue.Mutex);
+        queue.Tasks.push_back(std::move(task));
+        _unfinished++;
+        _queued++;
+    }
+
     unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
     _condPending.notify_one();
+    _condComplete.notify_all();
 }
 
-void JobPool::Join(std::function<void()> reportFn)
+void JobPool::AddTasks(std::vector<Task>&& tasks)
 {
-    unique_lock lock(_mutex);
-    while (true)
+    if (tasks.empty())
+        return;
+
+    // Hand out contiguous blocks so that each queue is only locked once.
+    const auto numQueues = _queues.size();
+    const auto blockSize = (tasks.size() + numQueues - 1) / numQueues;
+    const auto firstQueue = GetCurrentQueueIndex();
+    for (size_t n = 0; n < numQueues; n++)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        const auto begin = n * blockSize;
+        if (begin >= tasks.size())
+            break;
+        const auto end = std::min(tasks.size(), begin + blockSize);
 
-        // Dispatch all completion callbacks if there are any.
-        while (!_completed.empty())
+        auto& queue = *_queues[(firstQueue + n) % numQueues];
+        std::scoped_lock lock(queue.Mutex);
+        for (auto i = begin; i < end; i++)
         {
-            auto taskData = _completed.front();
-            _completed.pop_front();
-
-            if (taskData.CompletionFn)
-            {
-                lock.unlock();
+            queue.Tasks.push_back(std::move(tasks[i]));
+        }
+        _unfinished += end - begin;
+        _queued += end - begin;
+    }
+    tasks.clear();
 
-                taskData.CompletionFn();
+    unique_lock lock(_mutex);
+    _condPending.notify_all();
+    _condComplete.notify_all();
+}
 
-                lock.lock();
-            }
+void JobPool::Join(std::function<void()> reportFn)
+{
+    const auto ownQueue = _workerPool == this ? _workerQueueIndex : _nextQueue.load() % _queues.size();
+    while (_unfinished != 0)
+    {
+        if (!TryRunTask(ownQueue))
+        {
+            // Remaining tasks are running on other threads, wait for them to complete or to queue more work.
+            unique_lock lock(_mutex);
+            _condComplete.wait(lock, [this]() { return _unfinished == 0 || _queued != 0; });
         }
 
         if (reportFn)
         {
-            lock.unlock();
-
             reportFn();
-
-            lock.lock();
-        }
-
-        // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
-        {
-            break;
         }
     }
 }
 
 size_t JobPool::CountPending()
 {
-    unique_lock lock(_mutex);
-    return _pending.size();
+    return _queued;
 }
 
-void JobPool::ProcessQueue()
+size_t JobPool::GetThreadCount() const
 {
-    unique_lock lock(_mutex);
-    do
+    return _threads.size();
+}
+
+size_t JobPool::GetCurrentQueueIndex()
+{
+    if (_workerPool == this)
     {
-        // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        return _workerQueueIndex;
+    }
+    return _nextQueue++ % _queues.size();
+}
+
+bool JobPool::TryRunTask(size_t queueIndex)
+{
+    std::optional<Task> task;
 
-        if (!_pending.empty())
+    // Take the most recently added task from our own queue, it is the most likely to still be in cache.
+    {
+        auto& queue = *_queues[queueIndex];
+        std::scoped_lock lock(queue.Mutex);
+        if (!queue.Tasks.empty())
+        {
+            task.emplace(std::move(queue.Tasks.back()));
+            queue.Tasks.pop_back();
+        }
+    }
+
+    // Otherwise steal the oldest task from one of the other queues.
+    for (size_t n = 1; !task.has_value() && n < _queues.size(); n++)
+    {
+        auto& queue = *_queues[(queueIndex + n) % _queues.size()];
+        std::scoped_lock lock(queue.Mutex);
+        if (!queue.Tasks.empty())
         {
-            _processing++;
+            task.emplace(std::move(queue.Tasks.front()));
+            queue.Tasks.pop_front();
+        }
+    }
 
-            auto taskData = _pending.front();
-            _pending.pop_front();
+    if (!task.has_value())
+        return false;
 
-            lock.unlock();
+    _queued--;
+    (*task)();
+    CompleteTask();
+    return true;
+}
 
-            taskData.WorkFn();
+void JobPool::CompleteTask()
+{
+    if (--_unfinished == 0)
+    {
+        unique_lock lock(_mutex);
+        _condComplete.notify_all();
+    }
+}
 
-            lock.lock();
+void JobPool::ProcessQueue(size_t queueIndex)
+{
+    _workerPool = this;
+    _workerQueueIndex = queueIndex;
 
-            _completed.push_back(std::move(taskData));
+    while (!_shouldStop)
+    {
+        if (TryRunTask(queueIndex))
+            continue;
 
-            _processing--;
-            _condComplete.notify_one();
-        }
-    } while (!_shouldStop);
+        // Wait for work or cancellation.
+        unique_lock lock(_mutex);
+        _condPending.wait(lock, [this]() { return _shouldStop || _queued != 0; });
+    }
 }
@@ -9,30 +9,164 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+/**
+ * Work-stealing thread pool. Every worker owns a queue, tasks added from a worker go to its own
+ * queue and tasks added from other threads are spread over all queues. Idle workers steal from the
+ * other queues and Join() executes pending tasks on the calling thread until all work is done.
+ */
 class JobPool
 {
-private:
-    struct TaskData
+public:
+    /**
+     * Move-only callable with inline storage, small lambdas are stored without a heap allocation.
+     */
+    class Task
     {
-        const std::function<void()> WorkFn;
-        const std::function<void()> CompletionFn;
+    public:
+        static constexpr size_t InlineSize = sizeof(void*) * 8;
+
+        template<typename TFn, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TFn>, Task>>>
+        Task(TFn&& fn)
+        {
+            using TStored = std::decay_t<TFn>;
+            if constexpr (sizeof(TStored) <= InlineSize && alignof(TStored) <= alignof(std::max_align_t))
+            {
+                new (_storage) TStored(std::forward<TFn>(fn));
+                _ops = &InlineOps<TStored>;
+            }
+            else
+            {
+                new (_storage) TStored*(new TStored(std::forward<TFn>(fn)));
+                _ops = &HeapOps<TStored>;
+            }
+        }
+
+        Task(Task&& other) noexcept
+            : _ops(other._ops)
+        {
+            if (_ops != nullptr)
+            {
+                _ops->Move(_storage, other._storage);
+                other._ops = nullptr;
+            }
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                _ops = other._ops;
+                if (_ops != nullptr)
+                {
+                    _ops->Move(_storage, other._storage);
+                    other._ops = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            Reset();
+        }
+
+        void operator()()
+        {
+            _ops->Invoke(_storage);
+        }
+
+    private:
+        struct Operations
+        {
+            void (*Invoke)(void* storage);
+            void (*Move)(void* dst, void* src) noexcept;
+            void (*Destroy)(void* storage) noexcept;
+        };
+
+        template<typename TStored> static void InvokeInline(void* storage)
+        {
+            (*static_cast<TStored*>(storage))();
+        }
+
+        template<typename TStored> static void MoveInline(void* dst, void* src) noexcept
+        {
+            auto* srcFn = static_cast<TStored*>(src);
+            new (dst) TStored(std::move(*srcFn));
+            srcFn->~TStored();
+        }
+
+        template<typename TStored> static void DestroyInline(void* storage) noexcept
+        {
+            static_cast<TStored*>(storage)->~TStored();
+        }
+
+        template<typename TStored> static void InvokeHeap(void* storage)
+        {
+            (**static_cast<TStored**>(storage))();
+        }
+
+        template<typename TStored> static void MoveHeap(void* dst, void* src) noexcept
+        {
+            new (dst) TStored*(*static_cast<TStored**>(src));
+        }
+
+        template<typename TStored> static void DestroyHeap(void* storage) noexcept
+        {
+            delete *static_cast<TStored**>(storage);
+        }
 
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn);
+        template<typename TStored>
+        static constexpr Operations InlineOps = { &InvokeInline<TStored>, &MoveInline<TStored>, &DestroyInline<TStored> };
+
+        template<typename TStored>
+        static constexpr Operations HeapOps = { &InvokeHeap<TStored>, &MoveHeap<TStored>, &DestroyHeap<TStored> };
+
+        void Reset() noexcept
+        {
+            if (_ops != nullptr)
+            {
+                _ops->Destroy(_storage);
+                _ops = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) std::byte _storage[InlineSize];
+        const Operations* _ops{};
+    };
+
+private:
+    struct WorkQueue
+    {
+        std::mutex Mutex;
+        std::deque<Task> Tasks;
     };
 
     std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
+    // Tasks that have been added but not yet started.
+    std::atomic<size_t> _queued = { 0 };
+    // Tasks that have been added but not yet finished.
+    std::atomic<size_t> _unfinished = { 0 };
+    std::atomic<size_t> _nextQueue = { 0 };
+    std::vector<std::unique_ptr<WorkQueue>> _queues;
     std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
     std::condition_variable _condPending;
     std::condition_variable _condComplete;
     std::mutex _mutex;
@@ -43,10 +177,59 @@ public:
     JobPool(size_t maxThreads = 255);
     ~JobPool();
 
-    void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
+    void AddTask(Task&& task);
+    void AddTasks(std::vector<Task>&& tasks);
+
+    /**
+     * Waits for all tasks to complete, the calling thread executes pending tasks in the meantime.
+     * Must not be called from within a task of the same pool.
+     * @param reportFn Called on the calling thread each time it finishes a task or wakes up.
+     */
     void Join(std::function<void()> reportFn = nullptr);
+
     size_t CountPending();
+    size_t GetThreadCount() const;
+
+    /**
+     * Splits [0, count) into ranges of at least minRangeSize elements, calls fn(begin, end) for each
+     * range on the pool and waits for all of them to complete.
+     */
+    template<typename TFn> void ParallelForRange(size_t count, size_t minRangeSize, TFn&& fn)
+    {
+        if (count == 0)
+            return;
+
+        // A few ranges per thread so that stealing can even out uneven work.
+        const auto maxRanges = std::max<size_t>(1, (_threads.size() + 1) * 4);
+        const auto rangeSize = std::max({ minRangeSize, (count + maxRanges - 1) / maxRanges, size_t{ 1 } });
+
+        std::vector<Task> tasks;
+        tasks.reserve((count + rangeSize - 1) / rangeSize);
+        for (size_t begin = 0; begin < count; begin += rangeSize)
+        {
+            const auto end = std::min(count, begin + rangeSize);
+            tasks.emplace_back([&fn, begin, end]() { fn(begin, end); });
+        }
+        AddTasks(std::move(tasks));
+        Join();
+    }
+
+    /**
+     * Calls fn(index) for every index in [0, count) on the pool and waits for all of them to complete.
+     */
+    template<typename TFn> void ParallelFor(size_t count, TFn&& fn)
+    {
+        ParallelForRange(count, 1, [&fn](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                fn(i);
+            }
+        });
+    }
 
 private:
-    void ProcessQueue();
+    size_t GetCurrentQueueIndex();
+    bool TryRunTask(size_t queueIndex);
+    void CompleteTask();
+    void ProcessQueue(size_t queueIndex);
 };
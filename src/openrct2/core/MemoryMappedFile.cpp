@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFile.h"
+
+#include "IStream.hpp"
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(u8string_view path)
+    {
+        auto pathW = String::ToWideChar(path);
+        auto hFile = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE)
+        {
+            throw IOException("Unable to open '" + u8string(path) + "'");
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(hFile, &fileSize))
+        {
+            CloseHandle(hFile);
+            throw IOException("Unable to get the size of '" + u8string(path) + "'");
+        }
+        _length = static_cast<size_t>(fileSize.QuadPart);
+        if (_length == 0)
+        {
+            CloseHandle(hFile);
+            return;
+        }
+
+        // The mapping keeps its own reference to the file.
+        _mapping = CreateFileMappingW(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(hFile);
+        if (_mapping == nullptr)
+        {
+            throw IOException("Unable to map '" + u8string(path) + "'");
+        }
+
+        _data = static_cast<uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0));
+        if (_data == nullptr)
+        {
+            CloseHandle(_mapping);
+            throw IOException("Unable to map '" + u8string(path) + "'");
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping != nullptr)
+        {
+            CloseHandle(_mapping);
+        }
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(u8string_view path)
+    {
+        auto fd = open(u8string(path).c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException("Unable to open '" + u8string(path) + "'");
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+        {
+            close(fd);
+            throw IOException("Unable to open '" + u8string(path) + "'");
+        }
+        _length = static_cast<size_t>(fileStat.st_size);
+        if (_length == 0)
+        {
+            close(fd);
+            return;
+        }
+
+        // Private mappings stay backed by the page cache until a page is written to. The mapping keeps its own
+        // reference to the file.
+        auto* data = mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            throw IOException("Unable to map '" + u8string(path) + "'");
+        }
+        _data = static_cast<uint8_t*>(data);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            munmap(_data, _length);
+        }
+    }
+#endif
+} // namespace OpenRCT2
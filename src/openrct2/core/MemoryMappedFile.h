@@ -0,0 +1,51 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "String.hpp"
+
+namespace OpenRCT2
+{
+    /**
+     * A read-only file mapped into memory. The pages are loaded on first access and are shared with every other process
+     * that maps the same file. Writes to the memory are copy-on-write and never reach the file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        uint8_t* _data = nullptr;
+        size_t _length = 0;
+#ifdef _WIN32
+        void* _mapping = nullptr;
+#endif
+
+    public:
+        explicit MemoryMappedFile(u8string_view path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        uint8_t* GetData()
+        {
+            return _data;
+        }
+
+        const uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetLength() const
+        {
+            return _length;
+        }
+    };
+} // namespace OpenRCT2
@@ -9,15 +9,19 @@
 
 #pragma once
 
+#include "../util/Util.h"
 #include "../world/Location.hpp"
 #include "Crypt.h"
 #include "FileStream.h"
 #include "Identifier.hpp"
+#include "JobPool.h"
 #include "MemoryStream.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <exception>
 #include <fstream>
 #include <sstream>
 #include <stack>
@@ -37,6 +41,8 @@ namespace OpenRCT2
 
         static constexpr uint32_t COMPRESSION_NONE = 0;
         static constexpr uint32_t COMPRESSION_GZIP = 1;
+        // Every chunk is compressed separately, the compressed chunk table follows the chunk table.
+        static constexpr uint32_t COMPRESSION_GZIP_CHUNKS = 2;
 
     private:
 #pragma pack(push, 1)
@@ -60,6 +66,12 @@ namespace OpenRCT2
             uint64_t Offset{};
             uint64_t Length{};
         };
+
+        struct CompressedChunkEntry
+        {
+            uint64_t Offset{};
+            uint64_t Length{};
+        };
 #pragma pack(pop)
 
         IStream* _stream;
@@ -69,6 +81,12 @@ namespace OpenRCT2
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
 
+        // Only used for COMPRESSION_GZIP_CHUNKS when reading, chunks are decompressed on first access.
+        std::vector<CompressedChunkEntry> _compressedChunks;
+        std::vector<uint8_t> _compressedData;
+        std::vector<uint8_t> _uncompressedData;
+        std::vector<bool> _chunkDecompressed;
+
     public:
         OrcaStream(IStream& stream, const Mode mode)
         {
@@ -85,6 +103,12 @@ namespace OpenRCT2
                     _chunks.push_back(entry);
                 }
 
+                if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+                {
+                    ReadCompressedChunks();
+                    return;
+                }
+
                 // Read compressed data into buffer (read in blocks)
                 _buffer = MemoryStream{};
                 uint8_t temp[2048];
@@ -112,7 +136,7 @@ namespace OpenRCT2
             else
             {
                 _header = {};
-                _header.Compression = COMPRESSION_GZIP;
+                _header.Compression = COMPRESSION_GZIP_CHUNKS;
 
                 _buffer = MemoryStream{};
             }
@@ -132,6 +156,17 @@ namespace OpenRCT2
                 _header.CompressedSize = uncompressedSize;
                 _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
 
+                if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+                {
+                    if (WriteCompressedChunks())
+                    {
+                        return;
+                    }
+
+                    // Compression failed
+                    _header.Compression = COMPRESSION_NONE;
+                }
+
                 // Compress data
                 std::optional<std::vector<uint8_t>> compressedBytes;
                 if (_header.Compression == COMPRESSION_GZIP)
@@ -206,12 +241,83 @@ namespace OpenRCT2
             return true;
         }
 
+        /**
+         * Copies a park written with COMPRESSION_NONE to another stream using the given compression.
+         */
+        static void Compress(IStream& input, IStream& output, const uint32_t compression)
+        {
+            OrcaStream uncompressed(input, Mode::READING);
+            if (uncompressed._header.Compression != COMPRESSION_NONE)
+            {
+                throw IOException("Stream is already compressed.");
+            }
+
+            OrcaStream compressed(output, Mode::WRITING);
+            compressed._header = uncompressed._header;
+            compressed._header.Compression = compression;
+            compressed._chunks = uncompressed._chunks;
+            compressed._buffer = std::move(uncompressed._buffer);
+        }
+
+        /**
+         * Decompresses all chunks that have not been accessed yet using multiple threads. Chunks are
+         * otherwise decompressed one at a time when they are first read.
+         */
+        void DecompressChunks()
+        {
+            std::vector<size_t> pending;
+            for (size_t i = 0; i < _chunkDecompressed.size(); i++)
+            {
+                if (!_chunkDecompressed[i])
+                {
+                    pending.push_back(i);
+                }
+            }
+            if (pending.size() == 1)
+            {
+                DecompressChunk(pending[0]);
+            }
+            else if (pending.size() > 1)
+            {
+                // Exceptions must not escape the worker threads, rethrow the first one here instead.
+                std::vector<std::exception_ptr> errors(pending.size());
+                GetChunkJobs().ParallelFor(pending.size(), [this, &pending, &errors](size_t i) {
+                    try
+                    {
+                        DecompressChunk(pending[i]);
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                });
+                for (const auto& error : errors)
+                {
+                    if (error != nullptr)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+            for (auto index : pending)
+            {
+                _chunkDecompressed[index] = true;
+            }
+        }
+
     private:
         bool SeekChunk(const uint32_t id)
         {
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
             if (result != _chunks.end())
             {
+                const auto index = static_cast<size_t>(result - _chunks.begin());
+                if (index < _chunkDecompressed.size() && !_chunkDecompressed[index])
+                {
+                    DecompressChunk(index);
+                    _chunkDecompressed[index] = true;
+                }
+
                 const auto offset = result->Offset;
                 _buffer.SetPosition(offset);
                 return true;
@@ -219,6 +325,143 @@ namespace OpenRCT2
             return false;
         }
 
+        static bool IsRangeInside(uint64_t offset, uint64_t length, uint64_t size)
+        {
+            // Written so that corrupt offsets and lengths can not overflow.
+            return length <= size && offset <= size - length;
+        }
+
+        void ReadCompressedChunks()
+        {
+            _compressedChunks.clear();
+            for (uint32_t i = 0; i < _header.NumChunks; i++)
+            {
+                auto entry = _stream->ReadValue<CompressedChunkEntry>();
+                if (!IsRangeInside(entry.Offset, entry.Length, _header.CompressedSize))
+                {
+                    throw IOException("Compressed chunk is out of range.");
+                }
+                _compressedChunks.push_back(entry);
+            }
+            for (const auto& chunk : _chunks)
+            {
+                if (!IsRangeInside(chunk.Offset, chunk.Length, _header.UncompressedSize))
+                {
+                    throw IOException("Chunk is out of range.");
+                }
+            }
+            if (_header.CompressedSize > _stream->GetLength() - _stream->GetPosition())
+            {
+                throw IOException("Compressed data is larger than the stream.");
+            }
+
+            _compressedData.resize(static_cast<size_t>(_header.CompressedSize));
+            _stream->Read(_compressedData.data(), _compressedData.size());
+
+            _uncompressedData.resize(static_cast<size_t>(_header.UncompressedSize));
+            _buffer = MemoryStream(_uncompressedData.data(), _uncompressedData.size(), MEMORY_ACCESS::READ);
+            _chunkDecompressed.assign(_chunks.size(), false);
+        }
+
+        // Can be called for different chunks at the same time, each chunk only writes its own range.
+        void DecompressChunk(size_t index)
+        {
+            const auto& chunk = _chunks[index];
+            const auto& compressedChunk = _compressedChunks[index];
+            if (compressedChunk.Length == 0)
+            {
+                // Empty chunks are stored without any compressed data.
+                if (chunk.Length != 0)
+                {
+                    throw IOException("Chunk has an unexpected length.");
+                }
+                return;
+            }
+
+            const auto uncompressedChunk = Ungzip(
+                _compressedData.data() + compressedChunk.Offset, static_cast<size_t>(compressedChunk.Length));
+            if (uncompressedChunk.size() != chunk.Length)
+            {
+                throw IOException("Chunk has an unexpected length.");
+            }
+            std::copy(uncompressedChunk.begin(), uncompressedChunk.end(), _uncompressedData.begin() + chunk.Offset);
+        }
+
+        // Shared by every stream and only created once chunks are compressed or decompressed, so saving and
+        // loading do not start new threads every time.
+        static JobPool& GetChunkJobs()
+        {
+            static JobPool jobPool;
+            return jobPool;
+        }
+
+        // Returns false without writing anything if a chunk could not be compressed. This is called from the
+        // destructor so exceptions are caught instead of being passed on.
+        bool WriteCompressedChunks()
+        {
+            const auto* uncompressedData = static_cast<const uint8_t*>(_buffer.GetData());
+
+            std::vector<std::vector<uint8_t>> compressedChunks(_chunks.size());
+            std::atomic_bool failed = false;
+            try
+            {
+                GetChunkJobs().ParallelFor(_chunks.size(), [&](size_t i) {
+                    // Empty chunks are stored without any compressed data, Gzip can not compress zero bytes.
+                    if (_chunks[i].Length == 0)
+                        return;
+
+                    // Exceptions must not escape the worker threads.
+                    try
+                    {
+                        compressedChunks[i] = Gzip(
+                            uncompressedData + _chunks[i].Offset, static_cast<size_t>(_chunks[i].Length));
+                    }
+                    catch (...)
+                    {
+                        failed = true;
+                    }
+                });
+            }
+            catch (...)
+            {
+                failed = true;
+            }
+            if (failed)
+            {
+                return false;
+            }
+
+            uint64_t compressedSize = 0;
+            for (const auto& compressedChunk : compressedChunks)
+            {
+                compressedSize += compressedChunk.size();
+            }
+            _header.CompressedSize = compressedSize;
+
+            // Write header, chunk table and compressed chunk table
+            _stream->WriteValue(_header);
+            for (const auto& chunk : _chunks)
+            {
+                _stream->WriteValue(chunk);
+            }
+            uint64_t offset = 0;
+            for (const auto& compressedChunk : compressedChunks)
+            {
+                _stream->WriteValue(CompressedChunkEntry{ offset, compressedChunk.size() });
+                offset += compressedChunk.size();
+            }
+
+            // Write chunk data
+            for (const auto& compressedChunk : compressedChunks)
+            {
+                if (!compressedChunk.empty())
+                {
+                    _stream->Write(compressedChunk.data(), compressedChunk.size());
+                }
+            }
+            return true;
+        }
+
     public:
         class ChunkStream
         {
@@ -42,6 +42,54 @@ void MaskAvx2(
     }
 }
 
+void BlitRLERunAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap)
+{
+    // Runs are at most 127 pixels long, so only zoom levels 0 and 1 can fill a vector
+    if (zoomLevel <= 1)
+    {
+        const __m256i zero = {};
+        const __m256i lowBytes = _mm256_set1_epi16(0x00FF);
+        const int32_t srcStep = 32 << zoomLevel;
+        const bool remap = (blendOp & (BLEND_SRC | BLEND_DST)) != 0;
+        while (numPixels >= srcStep)
+        {
+            const auto* src256 = reinterpret_cast<const __m256i*>(src);
+            __m256i colour;
+            if (zoomLevel == 0)
+            {
+                colour = _mm256_loadu_si256(src256);
+            }
+            else
+            {
+                // Packing works per 128-bit lane, so the quarters have to be put back in order afterwards
+                const __m256i first = _mm256_and_si256(_mm256_loadu_si256(src256), lowBytes);
+                const __m256i second = _mm256_and_si256(_mm256_loadu_si256(src256 + 1), lowBytes);
+                colour = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), _MM_SHUFFLE(3, 1, 2, 0));
+            }
+            const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst));
+            __m256i transparent = _mm256_cmpeq_epi8(colour, zero);
+            __m256i pixels = colour;
+            if (remap)
+            {
+                alignas(32) uint8_t colourBytes[32];
+                alignas(32) uint8_t mapped[32];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(colourBytes), colour);
+                paletteMap.Map(colourBytes, dst, mapped, sizeof(mapped), blendOp);
+                pixels = _mm256_load_si256(reinterpret_cast<const __m256i*>(mapped));
+                transparent = _mm256_or_si256(transparent, _mm256_cmpeq_epi8(pixels, zero));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_blendv_epi8(pixels, dest, transparent));
+
+            numPixels -= srcStep;
+            src += srcStep;
+            dst += 32;
+        }
+    }
+    BlitRLERunSse4_1(src, dst, numPixels, zoomLevel, blendOp, paletteMap);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +103,11 @@ void MaskAvx2(
     Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void BlitRLERunAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap)
+{
+    Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
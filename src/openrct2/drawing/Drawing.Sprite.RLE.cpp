@@ -9,9 +9,91 @@
 
 #include "Drawing.h"
 
+#include "../Diagnostic.h"
+#include "../util/Util.h"
+
 #include <algorithm>
 #include <cstring>
 
+template<DrawBlendOp TBlendOp, size_t TZoom>
+static void BlitRLERun(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, const PaletteMap& paletteMap)
+{
+    constexpr auto zoom = 1 << TZoom;
+    while (numPixels > 0)
+    {
+        BlitPixel<TBlendOp>(src, dst, paletteMap);
+        numPixels -= zoom;
+        src += zoom;
+        dst++;
+    }
+}
+
+template<DrawBlendOp TBlendOp>
+static void BlitRLERun(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, const PaletteMap& paletteMap)
+{
+    switch (zoomLevel)
+    {
+        case 0:
+            BlitRLERun<TBlendOp, 0>(src, dst, numPixels, paletteMap);
+            break;
+        case 1:
+            BlitRLERun<TBlendOp, 1>(src, dst, numPixels, paletteMap);
+            break;
+        case 2:
+            BlitRLERun<TBlendOp, 2>(src, dst, numPixels, paletteMap);
+            break;
+        case 3:
+            BlitRLERun<TBlendOp, 3>(src, dst, numPixels, paletteMap);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+void BlitRLERunScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap)
+{
+    switch (blendOp)
+    {
+        case BLEND_TRANSPARENT | BLEND_SRC | BLEND_DST:
+            BlitRLERun<BLEND_TRANSPARENT | BLEND_SRC | BLEND_DST>(src, dst, numPixels, zoomLevel, paletteMap);
+            break;
+        case BLEND_TRANSPARENT | BLEND_SRC:
+            BlitRLERun<BLEND_TRANSPARENT | BLEND_SRC>(src, dst, numPixels, zoomLevel, paletteMap);
+            break;
+        case BLEND_TRANSPARENT | BLEND_DST:
+            BlitRLERun<BLEND_TRANSPARENT | BLEND_DST>(src, dst, numPixels, zoomLevel, paletteMap);
+            break;
+        default:
+            BlitRLERun<BLEND_TRANSPARENT>(src, dst, numPixels, zoomLevel, paletteMap);
+            break;
+    }
+}
+
+static auto GetBlitRLERunFunction()
+{
+    if (AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 RLE blit function");
+        return BlitRLERunAvx2;
+    }
+    else if (SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 RLE blit function");
+        return BlitRLERunSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar RLE blit function");
+        return BlitRLERunScalar;
+    }
+}
+
+static const auto BlitRLERunFunc = GetBlitRLERunFunction();
+
 template<DrawBlendOp TBlendOp, size_t TZoom>
 static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
@@ -163,16 +245,14 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
                     std::memcpy(dst, src, numPixels);
                 }
             }
+            else if (numPixels >= (16 << TZoom))
+            {
+                // Only hand runs over to the vectorised blitters if they fill at least one vector
+                BlitRLERunFunc(src, dst, numPixels, static_cast<int32_t>(TZoom), TBlendOp, args.PalMap);
+            }
             else
             {
-                auto& paletteMap = args.PalMap;
-                while (numPixels > 0)
-                {
-                    BlitPixel<TBlendOp>(src, dst, paletteMap);
-                    numPixels -= zoom;
-                    src += zoom;
-                    dst++;
-                }
+                BlitRLERun<TBlendOp, TZoom>(src, dst, numPixels, args.PalMap);
             }
         }
     }
@@ -14,6 +14,7 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/Platform.h"
@@ -180,6 +181,55 @@ void MaskScalar(
     }
 }
 
+/**
+ * Opens a g1.dat style file for reading its headers. When memoryMapped is set the file is mapped into memory instead,
+ * the stream then reads from the mapping and the image data is never copied.
+ */
+static std::unique_ptr<IStream> OpenGxFile(Gx& gx, const u8string& path, bool memoryMapped)
+{
+    gx.data.reset();
+    gx.mappedFile.reset();
+    if (memoryMapped)
+    {
+        try
+        {
+            gx.mappedFile = std::make_shared<MemoryMappedFile>(path);
+            return std::make_unique<MemoryStream>(gx.mappedFile->GetData(), gx.mappedFile->GetLength());
+        }
+        catch (const IOException& e)
+        {
+            LOG_VERBOSE("Unable to map graphics file, reading it instead: %s", e.what());
+        }
+    }
+    return std::make_unique<FileStream>(path, FILE_MODE_OPEN);
+}
+
+/**
+ * Returns the image data that follows the current position of the stream, element offsets are relative to it.
+ */
+static uint8_t* ReadGxData(Gx& gx, IStream& stream)
+{
+    if (gx.mappedFile != nullptr)
+    {
+        auto position = stream.GetPosition();
+        if (stream.GetLength() - position < gx.header.total_size)
+        {
+            throw IOException("Graphics data is truncated");
+        }
+        return gx.mappedFile->GetData() + position;
+    }
+    gx.data = stream.ReadArray<uint8_t>(gx.header.total_size);
+    return gx.data.get();
+}
+
+static void UnloadGx(Gx& gx)
+{
+    gx.data.reset();
+    gx.mappedFile.reset();
+    gx.elements.clear();
+    gx.elements.shrink_to_fit();
+}
+
 static Gx _g1 = {};
 static Gx _g2 = {};
 static Gx _csg = {};
@@ -194,14 +244,14 @@ bool gTinyFontAntiAliased = false;
  *
  *  rct2: 0x00678998
  */
-bool GfxLoadG1(const IPlatformEnvironment& env)
+bool GfxLoadG1(const IPlatformEnvironment& env, bool memoryMapped)
 {
     LOG_VERBOSE("GfxLoadG1(...)");
     try
     {
         auto path = env.FindFile(DIRBASE::RCT2, DIRID::DATA, u8"g1.dat");
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g1.header = fs.ReadValue<RCTG1Header>();
+        auto fs = OpenGxFile(_g1, path, memoryMapped);
+        _g1.header = fs->ReadValue<RCTG1Header>();
 
         LOG_VERBOSE("g1.dat, number of entries: %u", _g1.header.num_entries);
 
@@ -213,23 +263,22 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
         // Read element headers
         bool is_rctc = _g1.header.num_entries == SPR_RCTC_G1_END;
         _g1.elements.resize(_g1.header.num_entries);
-        ReadAndConvertGxDat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
+        ReadAndConvertGxDat(fs.get(), _g1.header.num_entries, is_rctc, _g1.elements.data());
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        auto* data = ReadGxData(_g1, *fs);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
     catch (const std::exception&)
     {
-        _g1.elements.clear();
-        _g1.elements.shrink_to_fit();
+        UnloadGx(_g1);
 
         LOG_FATAL("Unable to load g1 graphics");
         if (!gOpenRCT2Headless)
@@ -243,26 +292,20 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
 
 void GfxUnloadG1()
 {
-    _g1.data.reset();
-    _g1.elements.clear();
-    _g1.elements.shrink_to_fit();
+    UnloadGx(_g1);
 }
 
 void GfxUnloadG2()
 {
-    _g2.data.reset();
-    _g2.elements.clear();
-    _g2.elements.shrink_to_fit();
+    UnloadGx(_g2);
 }
 
 void GfxUnloadCsg()
 {
-    _csg.data.reset();
-    _csg.elements.clear();
-    _csg.elements.shrink_to_fit();
+    UnloadGx(_csg);
 }
 
-bool GfxLoadG2()
+bool GfxLoadG2(bool memoryMapped)
 {
     LOG_VERBOSE("GfxLoadG2()");
 
@@ -272,15 +315,15 @@ bool GfxLoadG2()
 
     try
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g2.header = fs.ReadValue<RCTG1Header>();
+        auto fs = OpenGxFile(_g2, path, memoryMapped);
+        _g2.header = fs->ReadValue<RCTG1Header>();
 
         // Read element headers
         _g2.elements.resize(_g2.header.num_entries);
-        ReadAndConvertGxDat(&fs, _g2.header.num_entries, false, _g2.elements.data());
+        ReadAndConvertGxDat(fs.get(), _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        auto* data = ReadGxData(_g2, *fs);
 
         if (_g2.header.num_entries != G2_SPRITE_COUNT)
         {
@@ -301,14 +344,13 @@ bool GfxLoadG2()
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
     catch (const std::exception&)
     {
-        _g2.elements.clear();
-        _g2.elements.shrink_to_fit();
+        UnloadGx(_g2);
 
         LOG_FATAL("Unable to load g2 graphics");
         if (!gOpenRCT2Headless)
@@ -320,7 +362,7 @@ bool GfxLoadG2()
     return false;
 }
 
-bool GfxLoadCsg()
+bool GfxLoadCsg(bool memoryMapped)
 {
     LOG_VERBOSE("GfxLoadCsg()");
 
@@ -335,15 +377,16 @@ bool GfxLoadCsg()
     try
     {
         auto fileHeader = FileStream(pathHeaderPath, FILE_MODE_OPEN);
-        auto fileData = FileStream(pathDataPath, FILE_MODE_OPEN);
+        auto fileData = OpenGxFile(_csg, pathDataPath, memoryMapped);
         size_t fileHeaderSize = fileHeader.GetLength();
-        size_t fileDataSize = fileData.GetLength();
+        size_t fileDataSize = fileData->GetLength();
 
         _csg.header.num_entries = static_cast<uint32_t>(fileHeaderSize / sizeof(RCTG1Element));
         _csg.header.total_size = static_cast<uint32_t>(fileDataSize);
 
         if (!CsgIsUsable(_csg))
         {
+            _csg.mappedFile.reset();
             LOG_WARNING("Cannot load CSG1.DAT, it has too few entries. Only CSG1.DAT from Loopy Landscapes will work.");
             return false;
         }
@@ -353,12 +396,12 @@ bool GfxLoadCsg()
         ReadAndConvertGxDat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        auto* data = ReadGxData(_csg, *fileData);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -370,8 +413,7 @@ bool GfxLoadCsg()
     }
     catch (const std::exception&)
     {
-        _csg.elements.clear();
-        _csg.elements.shrink_to_fit();
+        UnloadGx(_csg);
 
         LOG_ERROR("Unable to load csg graphics");
         return false;
@@ -81,6 +81,36 @@ uint8_t PaletteMap::Blend(uint8_t src, uint8_t dst) const
     return (*this)[idx];
 }
 
+void PaletteMap::Map(const uint8_t* src, const uint8_t* dst, uint8_t* out, size_t count, DrawBlendOp blendOp) const
+{
+    const auto lookup = [this](size_t index) -> uint8_t { return index < _dataLength ? _data[index] : 0; };
+    if ((blendOp & BLEND_SRC) != 0 && (blendOp & BLEND_DST) != 0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = lookup((static_cast<uint8_t>(src[i] - 1) * 256) + dst[i]);
+        }
+    }
+    else if ((blendOp & BLEND_SRC) != 0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = lookup(src[i]);
+        }
+    }
+    else if ((blendOp & BLEND_DST) != 0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = lookup(dst[i]);
+        }
+    }
+    else
+    {
+        std::memcpy(out, src, count);
+    }
+}
+
 void PaletteMap::Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length)
 {
     auto maxLength = std::min(_mapLength - srcIndex, _mapLength - dstIndex);
@@ -29,6 +29,7 @@ namespace OpenRCT2
 {
     struct IPlatformEnvironment;
     struct IStream;
+    class MemoryMappedFile;
 } // namespace OpenRCT2
 
 namespace OpenRCT2::Drawing
@@ -102,6 +103,8 @@ struct Gx
     RCTG1Header header;
     std::vector<G1Element> elements;
     std::unique_ptr<uint8_t[]> data;
+    // Holds the image data instead of data when the file is mapped into memory
+    std::shared_ptr<OpenRCT2::MemoryMappedFile> mappedFile;
 };
 
 struct DrawPixelInfo
@@ -403,6 +406,12 @@ public:
     uint8_t& operator[](size_t index);
     uint8_t operator[](size_t index) const;
     uint8_t Blend(uint8_t src, uint8_t dst) const;
+
+    /**
+     * Maps a block of pixels at once for the vectorised blitters, indices out of range map to 0 like operator[].
+     * The result for transparent source pixels is undefined, callers are expected to mask them.
+     */
+    void Map(const uint8_t* src, const uint8_t* dst, uint8_t* out, size_t count, DrawBlendOp blendOp) const;
     void Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length);
 };
 
@@ -554,9 +563,9 @@ void GfxFillRectInset(DrawPixelInfo& dpi, const ScreenRect& rect, int32_t colour
 void GfxFilterRect(DrawPixelInfo& dpi, const ScreenRect& rect, FilterPaletteID palette);
 
 // sprite
-bool GfxLoadG1(const OpenRCT2::IPlatformEnvironment& env);
-bool GfxLoadG2();
-bool GfxLoadCsg();
+bool GfxLoadG1(const OpenRCT2::IPlatformEnvironment& env, bool memoryMapped = true);
+bool GfxLoadG2(bool memoryMapped = true);
+bool GfxLoadCsg(bool memoryMapped = true);
 void GfxUnloadG1();
 void GfxUnloadG2();
 void GfxUnloadCsg();
@@ -628,6 +637,18 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Blits one run of an RLE sprite for zoom levels 0 to 3, numPixels is the length of the run in source pixels.
+// The blend op must include BLEND_TRANSPARENT.
+void BlitRLERunScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap);
+void BlitRLERunSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap);
+void BlitRLERunAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(const uint8_t* colours, int32_t start_index, int32_t num_colours);
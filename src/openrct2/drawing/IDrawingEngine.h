@@ -51,6 +51,14 @@ namespace OpenRCT2::Drawing
 {
     struct IDrawingContext;
 
+    struct SpriteCacheStats
+    {
+        uint64_t Hits{};
+        uint64_t Misses{};
+        size_t Sprites{};
+        size_t MemoryUsage{};
+    };
+
     struct IDrawingEngine
     {
         virtual ~IDrawingEngine()
@@ -77,6 +85,9 @@ namespace OpenRCT2::Drawing
         virtual DRAWING_ENGINE_FLAGS GetFlags() abstract;
 
         virtual void InvalidateImage(uint32_t image) abstract;
+
+        // Engines without a cache of decoded sprites return empty statistics.
+        virtual SpriteCacheStats GetSpriteCacheStats() abstract;
     };
 
     struct IDrawingEngineFactory
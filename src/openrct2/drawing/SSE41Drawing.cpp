@@ -56,6 +56,77 @@ void MaskSse4_1(
     }
 }
 
+// Loads the 16 pixels that are sampled at the given zoom level, the source must hold 16 << zoomLevel pixels.
+static __m128i LoadRLEPixels(const uint8_t* src, int32_t zoomLevel)
+{
+    const auto* src128 = reinterpret_cast<const __m128i*>(src);
+    if (zoomLevel == 0)
+    {
+        return _mm_loadu_si128(src128);
+    }
+    else if (zoomLevel == 1)
+    {
+        // Keep the low byte of every 16-bit lane and pack them together
+        const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+        const __m128i first = _mm_and_si128(_mm_loadu_si128(src128), lowBytes);
+        const __m128i second = _mm_and_si128(_mm_loadu_si128(src128 + 1), lowBytes);
+        return _mm_packus_epi16(first, second);
+    }
+    else
+    {
+        // Same for every 32-bit lane, _mm_packus_epi32 is SSE4.1
+        const __m128i lowBytes = _mm_set1_epi32(0x000000FF);
+        const __m128i first = _mm_and_si128(_mm_loadu_si128(src128), lowBytes);
+        const __m128i second = _mm_and_si128(_mm_loadu_si128(src128 + 1), lowBytes);
+        const __m128i third = _mm_and_si128(_mm_loadu_si128(src128 + 2), lowBytes);
+        const __m128i fourth = _mm_and_si128(_mm_loadu_si128(src128 + 3), lowBytes);
+        return _mm_packus_epi16(_mm_packus_epi32(first, second), _mm_packus_epi32(third, fourth));
+    }
+}
+
+static __m128i BlendRLEPixels(
+    __m128i colour, __m128i dest, const uint8_t* destBytes, DrawBlendOp blendOp, const PaletteMap& paletteMap)
+{
+    const __m128i zero128 = {};
+    __m128i transparent = _mm_cmpeq_epi8(colour, zero128);
+    __m128i pixels = colour;
+    if ((blendOp & (BLEND_SRC | BLEND_DST)) != 0)
+    {
+        // There is no byte gather, so the palette lookups are done in a tight scalar loop
+        alignas(16) uint8_t colourBytes[16];
+        alignas(16) uint8_t mapped[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(colourBytes), colour);
+        paletteMap.Map(colourBytes, destBytes, mapped, sizeof(mapped), blendOp);
+        pixels = _mm_load_si128(reinterpret_cast<const __m128i*>(mapped));
+        transparent = _mm_or_si128(transparent, _mm_cmpeq_epi8(pixels, zero128));
+    }
+    return _mm_blendv_epi8(pixels, dest, transparent);
+}
+
+void BlitRLERunSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap)
+{
+    // Runs are at most 127 pixels long, so zoom level 3 never fills a vector
+    if (zoomLevel <= 2)
+    {
+        const int32_t srcStep = 16 << zoomLevel;
+        while (numPixels >= srcStep)
+        {
+            const __m128i colour = LoadRLEPixels(src, zoomLevel);
+            const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+            const __m128i blended = BlendRLEPixels(colour, dest, dst, blendOp, paletteMap);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), blended);
+
+            numPixels -= srcStep;
+            src += srcStep;
+            dst += 16;
+        }
+    }
+
+    BlitRLERunScalar(src, dst, numPixels, zoomLevel, blendOp, paletteMap);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +140,11 @@ void MaskSse4_1(
     Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void BlitRLERunSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomLevel, DrawBlendOp blendOp,
+    const PaletteMap& paletteMap)
+{
+    Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
@@ -13,6 +13,7 @@
 #include "../Game.h"
 #include "../Intro.h"
 #include "../config/Config.h"
+#include "../core/JobPool.h"
 #include "../core/Numerics.hpp"
 #include "../interface/Screenshot.h"
 #include "../interface/Viewport.h"
@@ -33,6 +34,10 @@ using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Ui;
 
+// Size of the screen tiles in dirty blocks, 256x256 pixels.
+constexpr uint32_t DirtyTileColumns = 2;
+constexpr uint32_t DirtyTileRows = 8;
+
 X8WeatherDrawer::X8WeatherDrawer()
 {
     _weatherPixels = new WeatherPixel[_weatherPixelsCapacity];
@@ -277,9 +282,14 @@ DRAWING_ENGINE_FLAGS X8DrawingEngine::GetFlags()
     return static_cast<DRAWING_ENGINE_FLAGS>(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING);
 }
 
-void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
+void X8DrawingEngine::InvalidateImage(uint32_t image)
 {
-    // Not applicable for this engine
+    _spriteCache.Invalidate(image);
+}
+
+SpriteCacheStats X8DrawingEngine::GetSpriteCacheStats()
+{
+    return _spriteCache.GetStats();
 }
 
 DrawPixelInfo* X8DrawingEngine::GetDPI()
@@ -287,6 +297,11 @@ DrawPixelInfo* X8DrawingEngine::GetDPI()
     return &_bitsDPI;
 }
 
+X8SpriteCache& X8DrawingEngine::GetSpriteCache()
+{
+    return _spriteCache;
+}
+
 void X8DrawingEngine::ConfigureBits(uint32_t width, uint32_t height, uint32_t pitch)
 {
     size_t newBitsSize = pitch * height;
@@ -360,6 +375,11 @@ void X8DrawingEngine::ConfigureDirtyGrid()
 
     delete[] _dirtyGrid.Blocks;
     _dirtyGrid.Blocks = new uint8_t[_dirtyGrid.BlockColumns * _dirtyGrid.BlockRows];
+
+    _dirtyTileColumns = (_dirtyGrid.BlockColumns + DirtyTileColumns - 1) / DirtyTileColumns;
+    const auto dirtyTileRows = (_dirtyGrid.BlockRows + DirtyTileRows - 1) / DirtyTileRows;
+    _dirtyTiles.clear();
+    _dirtyTiles.resize(_dirtyTileColumns * dirtyTileRows);
 }
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
@@ -382,6 +402,15 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
     //
     // Would currently redraw {2,2} to {3,5} where {3,4} and {3,5} are not dirty. Choosing to do this
     // per column eliminates this issue but limits it to rendering just a single column at a time.
+    //
+    // With multithreading the regions are grouped into screen tiles instead, so the main viewport can be rendered
+    // for several tiles in parallel.
+
+    const bool useTiles = gConfigGeneral.MultiThreading;
+    if (!useTiles && _tileJobs != nullptr)
+    {
+        _tileJobs.reset();
+    }
 
     for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
     {
@@ -398,9 +427,19 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
 
             // Check rows
             auto rows = GetNumDirtyRows(x, y, columns);
-            DrawDirtyBlocks(x, y, columns, rows);
+            if (useTiles)
+            {
+                // Regions must not cross into the next tile, the rest is picked up in the next row.
+                rows = std::min(rows, DirtyTileRows - (y % DirtyTileRows));
+            }
+            DrawDirtyBlocks(x, y, columns, rows, useTiles);
         }
     }
+
+    if (useTiles)
+    {
+        DrawDirtyTiles();
+    }
 }
 
 uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns)
@@ -421,7 +460,7 @@ uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, co
     return yy - y;
 }
 
-void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
+void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows, bool useTiles)
 {
     uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
     uint8_t* screenDirtyBlocks = _dirtyGrid.Blocks;
@@ -448,7 +487,80 @@ void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns,
 
     // Draw region
     OnDrawDirtyBlock(x, y, columns, rows);
-    WindowDrawAll(_bitsDPI, left, top, right, bottom);
+    if (useTiles)
+    {
+        const auto tile = (y / DirtyTileRows) * _dirtyTileColumns + (x / DirtyTileColumns);
+        _dirtyTiles[tile].emplace_back(
+            static_cast<int32_t>(left), static_cast<int32_t>(top), static_cast<int32_t>(right), static_cast<int32_t>(bottom));
+    }
+    else
+    {
+        WindowDrawAll(_bitsDPI, left, top, right, bottom);
+    }
+}
+
+void X8DrawingEngine::DrawDirtyTiles()
+{
+    _drawnTiles.clear();
+    for (size_t i = 0; i < _dirtyTiles.size(); i++)
+    {
+        if (!_dirtyTiles[i].empty())
+        {
+            _drawnTiles.push_back(i);
+        }
+    }
+    if (_drawnTiles.empty())
+    {
+        return;
+    }
+
+    // Only the main viewport is rendered in parallel, each tile renders the part of it that lies in the tile. The
+    // other windows are drawn over it afterwards on this thread, as their draw events are not safe to run elsewhere.
+    auto* mainWindow = WindowGetMain();
+    const auto* mainViewport = WindowGetViewport(mainWindow);
+    const bool renderMainViewport = mainViewport != nullptr && WindowIsVisible(*mainWindow);
+    if (renderMainViewport)
+    {
+        const auto renderTile = [this, mainViewport](size_t tile, bool useMultithreading) {
+            for (const auto& rect : _dirtyTiles[tile])
+            {
+                auto tileDPI = _bitsDPI.Crop(rect.Point1, { rect.GetWidth(), rect.GetHeight() });
+                ViewportRender(tileDPI, mainViewport, rect, useMultithreading);
+            }
+        };
+
+        if (_drawnTiles.size() == 1)
+        {
+            renderTile(_drawnTiles[0], true);
+        }
+        else
+        {
+            if (_tileJobs == nullptr)
+            {
+                _tileJobs = std::make_unique<JobPool>();
+            }
+
+            // The tiles do not overlap, so each one writes to its own part of the screen. The viewport columns are
+            // painted by the tile's own thread rather than handing them to another job pool.
+            _tileJobs->ParallelFor(_drawnTiles.size(), [this, &renderTile](size_t i) { renderTile(_drawnTiles[i], false); });
+        }
+    }
+
+    for (auto tile : _drawnTiles)
+    {
+        for (const auto& rect : _dirtyTiles[tile])
+        {
+            if (renderMainViewport)
+            {
+                WindowDrawAllAboveMainViewport(_bitsDPI, rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom());
+            }
+            else
+            {
+                WindowDrawAll(_bitsDPI, rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom());
+            }
+        }
+        _dirtyTiles[tile].clear();
+    }
 }
 
 #ifdef __WARN_SUGGEST_FINAL_METHODS__
@@ -720,7 +832,10 @@ void X8DrawingContext::DrawLine(DrawPixelInfo* dpi, uint32_t colour, const Scree
 
 void X8DrawingContext::DrawSprite(DrawPixelInfo* dpi, const ImageId imageId, int32_t x, int32_t y)
 {
-    GfxDrawSpriteSoftware(*dpi, imageId, { x, y });
+    if (!_engine->GetSpriteCache().Draw(*dpi, imageId, { x, y }))
+    {
+        GfxDrawSpriteSoftware(*dpi, imageId, { x, y });
+    }
 }
 
 void X8DrawingContext::DrawSpriteRawMasked(
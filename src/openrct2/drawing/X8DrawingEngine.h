@@ -12,8 +12,12 @@
 #include "../common.h"
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
+#include "X8SpriteCache.h"
 
 #include <memory>
+#include <vector>
+
+class JobPool;
 
 namespace OpenRCT2
 {
@@ -82,6 +86,13 @@ namespace OpenRCT2
 
             X8WeatherDrawer _weatherDrawer;
             X8DrawingContext* _drawingContext;
+            X8SpriteCache _spriteCache;
+
+            // Dirty regions grouped by the screen tile they are in, the main viewport is rendered for the tiles in parallel.
+            std::vector<std::vector<ScreenRect>> _dirtyTiles;
+            std::vector<size_t> _drawnTiles;
+            uint32_t _dirtyTileColumns = 0;
+            std::unique_ptr<JobPool> _tileJobs;
 
         public:
             explicit X8DrawingEngine(const std::shared_ptr<Ui::IUiContext>& uiContext);
@@ -111,8 +122,10 @@ namespace OpenRCT2
             DrawPixelInfo* GetDrawingPixelInfo() override;
             DRAWING_ENGINE_FLAGS GetFlags() override;
             void InvalidateImage(uint32_t image) override;
+            SpriteCacheStats GetSpriteCacheStats() override;
 
             DrawPixelInfo* GetDPI();
+            X8SpriteCache& GetSpriteCache();
 
         protected:
             void ConfigureBits(uint32_t width, uint32_t height, uint32_t pitch);
@@ -122,7 +135,8 @@ namespace OpenRCT2
             void ConfigureDirtyGrid();
             void DrawAllDirtyBlocks();
             uint32_t GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns);
-            void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
+            void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows, bool useTiles);
+            void DrawDirtyTiles();
         };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
 #    pragma GCC diagnostic pop
@@ -0,0 +1,340 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "X8SpriteCache.h"
+
+#include "../sprites.h"
+#include "../util/Math.hpp"
+#include "Drawing.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+// Sprites bigger than this are mostly window backgrounds, they are drawn rarely and would push everything else out.
+constexpr int32_t MaxCachedSpriteArea = 256 * 256;
+
+// Room around the sprite when decoding it, zoomed pixels are placed slightly differently than the full size ones.
+constexpr int32_t DecodeMargin = 64;
+
+X8SpriteCache::X8SpriteCache(size_t maxMemoryUsage)
+    : _maxMemoryUsage(maxMemoryUsage)
+{
+}
+
+bool X8SpriteCache::Draw(DrawPixelInfo& dpi, const ImageId imageId, const ScreenCoordsXY& coords)
+{
+    if (!imageId.HasValue() || imageId.IsBlended())
+    {
+        return false;
+    }
+    if (dpi.zoom_level < ZoomLevel{ 0 } || dpi.zoom_level > ZoomLevel::max())
+    {
+        return false;
+    }
+
+    // The sprite only samples the same source pixels at other positions if the area is aligned to the zoom level.
+    const int32_t zoomMask = dpi.zoom_level.ApplyTo(1) - 1;
+    if ((dpi.x & zoomMask) != 0 || (dpi.y & zoomMask) != 0)
+    {
+        return false;
+    }
+
+    // Scrolling text is redrawn all the time and the temporary image is changed without invalidating it.
+    const auto index = imageId.GetIndex();
+    if (index == SPR_TEMP || (index >= SPR_SCROLLING_TEXT_START && index < SPR_SCROLLING_TEXT_END))
+    {
+        return false;
+    }
+
+    const auto key = GetKey(imageId, dpi.zoom_level, coords);
+    auto sprite = Find(key);
+    if (sprite == nullptr)
+    {
+        sprite = CreateSprite(imageId, dpi.zoom_level, coords);
+        if (sprite == nullptr)
+        {
+            return false;
+        }
+        Insert(key, sprite);
+    }
+    BlitSprite(dpi, *sprite, coords);
+    return true;
+}
+
+void X8SpriteCache::Invalidate(ImageIndex image)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_imageRefCounts.find(image) == _imageRefCounts.end())
+    {
+        return;
+    }
+
+    for (auto it = _entries.begin(); it != _entries.end();)
+    {
+        const auto& images = it->CachedSprite->Images;
+        auto next = std::next(it);
+        if (images[0] == image || images[1] == image)
+        {
+            Remove(it);
+        }
+        it = next;
+    }
+}
+
+void X8SpriteCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _index.clear();
+    _imageRefCounts.clear();
+    _memoryUsage = 0;
+}
+
+SpriteCacheStats X8SpriteCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    SpriteCacheStats stats;
+    stats.Hits = _hits;
+    stats.Misses = _misses;
+    stats.Sprites = _entries.size();
+    stats.MemoryUsage = _memoryUsage;
+    return stats;
+}
+
+X8SpriteCache::Key X8SpriteCache::GetKey(const ImageId imageId, ZoomLevel zoomLevel, const ScreenCoordsXY& coords)
+{
+    uint64_t flags = 0;
+    flags |= imageId.HasPrimary() ? 1 : 0;
+    flags |= imageId.HasSecondary() ? 2 : 0;
+    flags |= imageId.HasTertiary() ? 4 : 0;
+
+    Key key{};
+    key.Image = (static_cast<uint64_t>(imageId.GetIndex()) << 32) | (static_cast<uint64_t>(imageId.GetPrimary()) << 24)
+        | (static_cast<uint64_t>(imageId.GetSecondary()) << 16) | (static_cast<uint64_t>(imageId.GetTertiary()) << 8)
+        | flags;
+
+    const int32_t zoomMask = zoomLevel.ApplyTo(1) - 1;
+    key.Placement = static_cast<uint8_t>(static_cast<int8_t>(zoomLevel)) | ((coords.x & zoomMask) << 8)
+        | ((coords.y & zoomMask) << 16);
+    return key;
+}
+
+std::shared_ptr<const X8SpriteCache::Sprite> X8SpriteCache::CreateSprite(
+    const ImageId imageId, ZoomLevel zoomLevel, const ScreenCoordsXY& coords)
+{
+    const auto* g1 = GfxGetG1Element(imageId);
+    if (g1 == nullptr || g1->width * g1->height > MaxCachedSpriteArea)
+    {
+        return nullptr;
+    }
+
+    // Find the image that is actually drawn at this zoom level, only RLE images leave the transparent pixels alone.
+    auto drawnIndex = imageId.GetIndex();
+    const auto* drawnElement = g1;
+    int32_t drawnShift = 0;
+    for (auto level = zoomLevel; level > ZoomLevel{ 0 } && (drawnElement->flags & G1_FLAG_HAS_ZOOM_SPRITE); level--)
+    {
+        drawnShift++;
+        drawnIndex -= drawnElement->zoomed_offset;
+        drawnElement = GfxGetG1Element(drawnIndex);
+        if (drawnElement == nullptr)
+        {
+            return nullptr;
+        }
+    }
+    if (!(drawnElement->flags & G1_FLAG_RLE_COMPRESSION))
+    {
+        return nullptr;
+    }
+
+    // Decode the sprite over two different backgrounds, so the pixels that were drawn can be told apart from the ones
+    // that were left alone. Those are the same in both buffers as none of the cached sprites depend on the background.
+    // The zoomed image is placed in its own coordinates, scaled back up it covers this area.
+    const int32_t drawnLeft = ((coords.x >> drawnShift) + drawnElement->x_offset) << drawnShift;
+    const int32_t drawnTop = ((coords.y >> drawnShift) + drawnElement->y_offset) << drawnShift;
+    const int32_t drawnRight = drawnLeft + (drawnElement->width << drawnShift);
+    const int32_t drawnBottom = drawnTop + (drawnElement->height << drawnShift);
+
+    DrawPixelInfo dpi{};
+    dpi.zoom_level = zoomLevel;
+    dpi.x = Floor2(drawnLeft, DecodeMargin) - DecodeMargin;
+    dpi.y = Floor2(drawnTop, DecodeMargin) - DecodeMargin;
+    dpi.width = Ceil2(drawnRight, DecodeMargin) + DecodeMargin - dpi.x;
+    dpi.height = Ceil2(drawnBottom, DecodeMargin) + DecodeMargin - dpi.y;
+
+    const auto width = zoomLevel.ApplyInversedTo(dpi.width);
+    const auto height = zoomLevel.ApplyInversedTo(dpi.height);
+    std::vector<uint8_t> cleared(static_cast<size_t>(width) * height, 0x00);
+    std::vector<uint8_t> filled(cleared.size(), 0xFF);
+    dpi.bits = cleared.data();
+    GfxDrawSpriteSoftware(dpi, imageId, coords);
+    dpi.bits = filled.data();
+    GfxDrawSpriteSoftware(dpi, imageId, coords);
+
+    const auto isDrawn = [&](int32_t x, int32_t y) {
+        const auto i = static_cast<size_t>(y) * width + x;
+        return cleared[i] != 0x00 || filled[i] != 0xFF;
+    };
+
+    // Crop to the pixels that were drawn
+    int32_t left = width;
+    int32_t top = height;
+    int32_t right = 0;
+    int32_t bottom = 0;
+    for (int32_t y = 0; y < height; y++)
+    {
+        for (int32_t x = 0; x < width; x++)
+        {
+            if (isDrawn(x, y))
+            {
+                left = std::min(left, x);
+                top = std::min(top, y);
+                right = std::max(right, x + 1);
+                bottom = std::max(bottom, y + 1);
+            }
+        }
+    }
+
+    auto sprite = std::make_shared<Sprite>();
+    sprite->Images[0] = imageId.GetIndex();
+    sprite->Images[1] = drawnIndex;
+    if (left >= right)
+    {
+        // Nothing is drawn, which is just as worth remembering
+        sprite->RowSpans.push_back(0);
+        return sprite;
+    }
+
+    sprite->OffsetX = dpi.x + zoomLevel.ApplyTo(left) - coords.x;
+    sprite->OffsetY = dpi.y + zoomLevel.ApplyTo(top) - coords.y;
+    sprite->Width = right - left;
+    sprite->Height = bottom - top;
+    sprite->Pixels.resize(static_cast<size_t>(sprite->Width) * sprite->Height);
+    for (int32_t y = 0; y < sprite->Height; y++)
+    {
+        sprite->RowSpans.push_back(static_cast<uint32_t>(sprite->Spans.size()));
+        std::memcpy(
+            sprite->Pixels.data() + static_cast<size_t>(y) * sprite->Width,
+            cleared.data() + static_cast<size_t>(top + y) * width + left, sprite->Width);
+
+        int32_t x = 0;
+        while (x < sprite->Width)
+        {
+            if (!isDrawn(left + x, top + y))
+            {
+                x++;
+                continue;
+            }
+            const auto start = x;
+            while (x < sprite->Width && isDrawn(left + x, top + y))
+            {
+                x++;
+            }
+            sprite->Spans.push_back({ static_cast<uint16_t>(start), static_cast<uint16_t>(x - start) });
+        }
+    }
+    sprite->RowSpans.push_back(static_cast<uint32_t>(sprite->Spans.size()));
+    return sprite;
+}
+
+void X8SpriteCache::BlitSprite(DrawPixelInfo& dpi, const Sprite& sprite, const ScreenCoordsXY& coords)
+{
+    const auto zoomLevel = dpi.zoom_level;
+    const int32_t zoom = zoomLevel.ApplyTo(1);
+
+    // The offsets are aligned to the zoom level, so these are exact. Like the RLE drawing, a zoomed pixel is drawn if its
+    // top left corner is inside the area.
+    const int32_t left = zoomLevel.ApplyInversedTo(coords.x + sprite.OffsetX - dpi.x);
+    const int32_t top = zoomLevel.ApplyInversedTo(coords.y + sprite.OffsetY - dpi.y);
+    const int32_t areaWidth = zoomLevel.ApplyInversedTo(dpi.width + zoom - 1);
+    const int32_t areaHeight = zoomLevel.ApplyInversedTo(dpi.height + zoom - 1);
+    const size_t stride = static_cast<size_t>(zoomLevel.ApplyInversedTo(dpi.width) + dpi.pitch);
+
+    const int32_t firstRow = std::max(0, -top);
+    const int32_t lastRow = std::min(sprite.Height, areaHeight - top);
+    const int32_t firstColumn = std::max(0, -left);
+    const int32_t lastColumn = std::min(sprite.Width, areaWidth - left);
+    for (int32_t y = firstRow; y < lastRow; y++)
+    {
+        const auto* src = sprite.Pixels.data() + static_cast<size_t>(y) * sprite.Width;
+        auto* dst = dpi.bits + (top + y) * stride;
+        for (auto i = sprite.RowSpans[y]; i < sprite.RowSpans[y + 1]; i++)
+        {
+            const auto& span = sprite.Spans[i];
+            const int32_t start = std::max<int32_t>(span.X, firstColumn);
+            const int32_t end = std::min<int32_t>(span.X + span.Length, lastColumn);
+            if (start < end)
+            {
+                std::memcpy(dst + left + start, src + start, end - start);
+            }
+        }
+    }
+}
+
+std::shared_ptr<const X8SpriteCache::Sprite> X8SpriteCache::Find(const Key& key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(key);
+    if (it == _index.end())
+    {
+        _misses++;
+        return nullptr;
+    }
+
+    _hits++;
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->CachedSprite;
+}
+
+void X8SpriteCache::Insert(const Key& key, std::shared_ptr<const Sprite> sprite)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Another paint thread might have decoded the same sprite in the meantime
+    auto existing = _index.find(key);
+    if (existing != _index.end())
+    {
+        Remove(existing->second);
+    }
+
+    _memoryUsage += sprite->GetMemoryUsage();
+    _imageRefCounts[sprite->Images[0]]++;
+    _imageRefCounts[sprite->Images[1]]++;
+    _entries.push_front({ key, std::move(sprite) });
+    _index[key] = _entries.begin();
+
+    while (_memoryUsage > _maxMemoryUsage && _entries.size() > 1)
+    {
+        Remove(std::prev(_entries.end()));
+    }
+}
+
+void X8SpriteCache::Remove(std::list<Entry>::iterator it)
+{
+    const auto& sprite = *it->CachedSprite;
+    _memoryUsage -= sprite.GetMemoryUsage();
+    for (auto image : sprite.Images)
+    {
+        auto refCount = _imageRefCounts.find(image);
+        if (refCount != _imageRefCounts.end() && --refCount->second == 0)
+        {
+            _imageRefCounts.erase(refCount);
+        }
+    }
+    _index.erase(it->SpriteKey);
+    _entries.erase(it);
+}
+
+size_t X8SpriteCache::Sprite::GetMemoryUsage() const
+{
+    return sizeof(Sprite) + Pixels.capacity() + Spans.capacity() * sizeof(Span) + RowSpans.capacity() * sizeof(uint32_t);
+}
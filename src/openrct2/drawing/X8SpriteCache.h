@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../interface/ZoomLevel.h"
+#include "../world/Location.hpp"
+#include "IDrawingEngine.h"
+#include "ImageId.hpp"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct DrawPixelInfo;
+
+namespace OpenRCT2::Drawing
+{
+    /**
+     * Keeps sprites that were already decoded, remapped and minified for a zoom level, so drawing them again only takes
+     * copies of their opaque spans. Only RLE sprites are cached, blended sprites depend on what is underneath them.
+     * The cache is shared by the paint threads, entries are dropped least recently used first.
+     */
+    class X8SpriteCache final
+    {
+    public:
+        static constexpr size_t DefaultMaxMemoryUsage = 32 * 1024 * 1024;
+
+        explicit X8SpriteCache(size_t maxMemoryUsage = DefaultMaxMemoryUsage);
+
+        /**
+         * Draws the sprite from the cache and decodes it first if it was not in there yet. Returns false if the sprite
+         * can not be cached, the caller has to draw it the regular way then.
+         */
+        bool Draw(DrawPixelInfo& dpi, const ImageId imageId, const ScreenCoordsXY& coords);
+        void Invalidate(ImageIndex image);
+        void Clear();
+        SpriteCacheStats GetStats() const;
+
+    private:
+        struct Key
+        {
+            uint64_t Image;
+            // Zoom level and the position of the sprite within a zoomed pixel, those sample different source pixels
+            uint32_t Placement;
+
+            bool operator==(const Key& other) const
+            {
+                return Image == other.Image && Placement == other.Placement;
+            }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const
+            {
+                return std::hash<uint64_t>()(key.Image ^ (static_cast<uint64_t>(key.Placement) << 40));
+            }
+        };
+
+        struct Span
+        {
+            uint16_t X;
+            uint16_t Length;
+        };
+
+        struct Sprite
+        {
+            // The image that was requested and the zoomed image that got drawn for it
+            ImageIndex Images[2]{};
+            // Position of the first pixel relative to the drawing coordinates, in 1:1 units
+            int32_t OffsetX{};
+            int32_t OffsetY{};
+            int32_t Width{};
+            int32_t Height{};
+            std::vector<uint8_t> Pixels;
+            std::vector<Span> Spans;
+            // Index of the first span of every row, followed by the number of spans
+            std::vector<uint32_t> RowSpans;
+
+            size_t GetMemoryUsage() const;
+        };
+
+        struct Entry
+        {
+            Key SpriteKey;
+            std::shared_ptr<const Sprite> CachedSprite;
+        };
+
+        mutable std::mutex _mutex;
+        std::list<Entry> _entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+        std::unordered_map<ImageIndex, uint32_t> _imageRefCounts;
+        size_t _maxMemoryUsage;
+        size_t _memoryUsage{};
+        uint64_t _hits{};
+        uint64_t _misses{};
+
+        static Key GetKey(const ImageId imageId, ZoomLevel zoomLevel, const ScreenCoordsXY& coords);
+        static std::shared_ptr<const Sprite> CreateSprite(
+            const ImageId imageId, ZoomLevel zoomLevel, const ScreenCoordsXY& coords);
+        static void BlitSprite(DrawPixelInfo& dpi, const Sprite& sprite, const ScreenCoordsXY& coords);
+
+        std::shared_ptr<const Sprite> Find(const Key& key);
+        void Insert(const Key& key, std::shared_ptr<const Sprite> sprite);
+        void Remove(std::list<Entry>::iterator it);
+    };
+} // namespace OpenRCT2::Drawing
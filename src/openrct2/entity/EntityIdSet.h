@@ -0,0 +1,180 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "../util/Util.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+/**
+ * A set of entity ids stored as bits, one bit for every possible id. Inserting and removing an id takes constant time
+ * and iterating visits the ids in ascending order, which the game relies on to stay deterministic. A second level of
+ * bits marks the blocks that hold any id, so iterating skips over empty ranges of ids quickly.
+ *
+ * Iterators look up the next id when they are advanced. Ids can be inserted and removed while iterating, ids inserted
+ * after the position of the iterator are visited, just like with a sorted list.
+ */
+class EntityIdSet
+{
+private:
+    static constexpr size_t NumIds = size_t{ 1 } << (sizeof(EntityId::UnderlyingType) * 8);
+    static constexpr size_t BitsPerBlock = 64;
+    static constexpr size_t NumBlocks = NumIds / BitsPerBlock;
+    static constexpr size_t NumSummaryBlocks = NumBlocks / BitsPerBlock;
+
+    std::array<uint64_t, NumBlocks> _blocks{};
+    std::array<uint64_t, NumSummaryBlocks> _summary{};
+    size_t _count{};
+
+    static size_t FindFirstBit(uint64_t bits)
+    {
+        return static_cast<size_t>(UtilBitScanForward(static_cast<int64_t>(bits)));
+    }
+
+    // Returns the first id at or after the index, NumIds if there is none.
+    size_t FindNext(size_t index) const
+    {
+        if (index >= NumIds)
+            return NumIds;
+
+        auto block = index / BitsPerBlock;
+        const auto bits = _blocks[block] & (~uint64_t{ 0 } << (index % BitsPerBlock));
+        if (bits != 0)
+            return block * BitsPerBlock + FindFirstBit(bits);
+
+        block++;
+        if (block >= NumBlocks)
+            return NumIds;
+
+        auto summaryBlock = block / BitsPerBlock;
+        auto summaryBits = _summary[summaryBlock] & (~uint64_t{ 0 } << (block % BitsPerBlock));
+        while (summaryBits == 0)
+        {
+            summaryBlock++;
+            if (summaryBlock >= NumSummaryBlocks)
+                return NumIds;
+            summaryBits = _summary[summaryBlock];
+        }
+        block = summaryBlock * BitsPerBlock + FindFirstBit(summaryBits);
+        return block * BitsPerBlock + FindFirstBit(_blocks[block]);
+    }
+
+public:
+    class Iterator
+    {
+    private:
+        const EntityIdSet* _set;
+        size_t _index;
+
+    public:
+        Iterator(const EntityIdSet* set, size_t index)
+            : _set(set)
+            , _index(index)
+        {
+        }
+
+        Iterator& operator++()
+        {
+            _index = _set->FindNext(_index + 1);
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator retval = *this;
+            ++(*this);
+            return retval;
+        }
+        bool operator==(const Iterator& other) const
+        {
+            return _index == other._index;
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+        EntityId operator*() const
+        {
+            return EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(_index));
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = EntityId;
+        using pointer = const EntityId*;
+        using reference = const EntityId&;
+        using iterator_category = std::forward_iterator_tag;
+    };
+    using const_iterator = Iterator;
+
+    void Insert(EntityId id)
+    {
+        const auto index = id.ToUnderlying();
+        const auto block = index / BitsPerBlock;
+        const auto bit = uint64_t{ 1 } << (index % BitsPerBlock);
+        if (_blocks[block] & bit)
+            return;
+
+        _blocks[block] |= bit;
+        _summary[block / BitsPerBlock] |= uint64_t{ 1 } << (block % BitsPerBlock);
+        _count++;
+    }
+
+    void Remove(EntityId id)
+    {
+        const auto index = id.ToUnderlying();
+        const auto block = index / BitsPerBlock;
+        const auto bit = uint64_t{ 1 } << (index % BitsPerBlock);
+        if (!(_blocks[block] & bit))
+            return;
+
+        _blocks[block] &= ~bit;
+        if (_blocks[block] == 0)
+        {
+            _summary[block / BitsPerBlock] &= ~(uint64_t{ 1 } << (block % BitsPerBlock));
+        }
+        _count--;
+    }
+
+    bool Contains(EntityId id) const
+    {
+        const auto index = id.ToUnderlying();
+        return (_blocks[index / BitsPerBlock] >> (index % BitsPerBlock)) & 1;
+    }
+
+    void clear()
+    {
+        _blocks.fill(0);
+        _summary.fill(0);
+        _count = 0;
+    }
+
+    size_t size() const
+    {
+        return _count;
+    }
+
+    bool empty() const
+    {
+        return _count == 0;
+    }
+
+    Iterator begin() const
+    {
+        return Iterator(this, FindNext(0));
+    }
+
+    Iterator end() const
+    {
+        return Iterator(this, NumIds);
+    }
+};
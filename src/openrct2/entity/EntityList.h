@@ -12,13 +12,15 @@
 #include "../common.h"
 #include "../rct12/RCT12.h"
 #include "../world/Location.hpp"
+#include "../world/Map.h"
 #include "EntityBase.h"
+#include "EntityIdSet.h"
 #include "EntityRegistry.h"
 
-#include <list>
+#include <algorithm>
 #include <vector>
 
-const std::list<EntityId>& GetEntityList(const EntityType id);
+const EntityIdSet& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
@@ -100,12 +102,12 @@ public:
 template<typename T> class EntityListIterator
 {
 private:
-    std::list<EntityId>::const_iterator iter;
-    std::list<EntityId>::const_iterator end;
+    EntityIdSet::const_iterator iter;
+    EntityIdSet::const_iterator end;
     T* Entity = nullptr;
 
 public:
-    EntityListIterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
+    EntityListIterator(EntityIdSet::const_iterator _iter, EntityIdSet::const_iterator _end)
         : iter(_iter)
         , end(_end)
     {
@@ -152,7 +154,7 @@ template<typename T = EntityBase> class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<EntityId>& vec;
+    const EntityIdSet& vec;
 
 public:
     EntityList()
@@ -169,3 +171,205 @@ public:
         return EntityListIterator_t(std::cend(vec), std::cend(vec));
     }
 };
+
+/**
+ * Calls the function for every entity of type T within the range, the edges of the range are included. Entities are
+ * looked up tile by tile in the spatial index, so they are not visited in id order and must not be moved by the
+ * function. Entities without a location are never visited.
+ */
+template<typename T, typename TFunc> void ForEachEntityInRange(const MapRange& range, TFunc&& func)
+{
+    const auto area = range.Normalise();
+    if (area.GetRight() < 0 || area.GetBottom() < 0)
+        return;
+
+    // The spatial index folds negative coordinates onto the positive tiles, only walk the tiles of the map.
+    const int32_t tileLeft = std::max(area.GetLeft(), 0) / COORDS_XY_STEP;
+    const int32_t tileTop = std::max(area.GetTop(), 0) / COORDS_XY_STEP;
+    const int32_t tileRight = std::min(area.GetRight() / COORDS_XY_STEP, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    const int32_t tileBottom = std::min(area.GetBottom() / COORDS_XY_STEP, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    for (int32_t tileX = tileLeft; tileX <= tileRight; tileX++)
+    {
+        for (int32_t tileY = tileTop; tileY <= tileBottom; tileY++)
+        {
+            for (auto* entity : EntityTileList<T>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                if (entity->x >= area.GetLeft() && entity->x <= area.GetRight() && entity->y >= area.GetTop()
+                    && entity->y <= area.GetBottom())
+                {
+                    func(entity);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Returns the entities of type T within the range in id order, the edges of the range are included.
+ */
+template<typename T> std::vector<T*> GetEntitiesInRange(const MapRange& range)
+{
+    std::vector<T*> result;
+    ForEachEntityInRange<T>(range, [&result](T* entity) { result.push_back(entity); });
+    std::sort(result.begin(), result.end(), [](const T* a, const T* b) { return a->Id < b->Id; });
+    return result;
+}
+
+/**
+ * Returns the entities of type T at most the radius away from the location in id order.
+ */
+template<typename T> std::vector<T*> GetEntitiesInRadius(const CoordsXY& loc, int32_t radius)
+{
+    std::vector<T*> result;
+    const auto radiusSquared = static_cast<int64_t>(radius) * radius;
+    ForEachEntityInRange<T>(
+        { loc.x - radius, loc.y - radius, loc.x + radius, loc.y + radius }, [&](T* entity) {
+            const int64_t dx = entity->x - loc.x;
+            const int64_t dy = entity->y - loc.y;
+            if (dx * dx + dy * dy <= radiusSquared)
+            {
+                result.push_back(entity);
+            }
+        });
+    std::sort(result.begin(), result.end(), [](const T* a, const T* b) { return a->Id < b->Id; });
+    return result;
+}
+
+// Once the rings around the location cover more tiles than this per entity of the type, the search scans the entity
+// list instead.
+constexpr size_t NearestEntitySearchTilesPerEntity = 4;
+
+/**
+ * Returns up to count entities of type T for which the predicate holds, closest first. Entities further away than
+ * maxDistance are left out, entities at the same distance are returned in id order.
+ *
+ * The search walks rings of tiles around the location until no tile further out can hold a closer entity. For this
+ * to work, the distance must never be smaller than the distance along the x or y axis.
+ */
+template<typename T, typename TDistance, typename TPredicate>
+std::vector<T*> GetNearestEntities(
+    const CoordsXY& loc, size_t count, int32_t maxDistance, TDistance&& getDistance, TPredicate&& predicate)
+{
+    struct Candidate
+    {
+        int32_t Distance;
+        T* Entity;
+    };
+
+    std::vector<Candidate> candidates;
+    const auto consider = [&](T* entity) {
+        if (!predicate(entity))
+            return;
+
+        const int32_t distance = getDistance(entity);
+        if (distance <= maxDistance)
+        {
+            candidates.push_back({ distance, entity });
+        }
+    };
+    const auto closer = [](const Candidate& a, const Candidate& b) {
+        return a.Distance < b.Distance || (a.Distance == b.Distance && a.Entity->Id < b.Entity->Id);
+    };
+
+    if (count == 0)
+        return {};
+
+    bool searched = false;
+    if (MapIsLocationValid(loc))
+    {
+        const auto centre = TileCoordsXY(loc);
+        const auto visitTile = [&consider](int32_t tileX, int32_t tileY) {
+            if (tileX < 0 || tileY < 0 || tileX >= MAXIMUM_MAP_SIZE_TECHNICAL || tileY >= MAXIMUM_MAP_SIZE_TECHNICAL)
+                return;
+
+            for (auto* entity : EntityTileList<T>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                consider(entity);
+            }
+        };
+
+        const int64_t maxDistanceRadius = (static_cast<int64_t>(maxDistance) + COORDS_XY_STEP - 1) / COORDS_XY_STEP;
+        const int32_t mapRadius = std::max(
+            { centre.x, centre.y, MAXIMUM_MAP_SIZE_TECHNICAL - 1 - centre.x, MAXIMUM_MAP_SIZE_TECHNICAL - 1 - centre.y });
+        const auto maxRadius = static_cast<int32_t>(std::min<int64_t>(maxDistanceRadius, mapRadius));
+        const size_t maxTiles = std::max<size_t>(GetEntityListCount(T::cEntityType), 1) * NearestEntitySearchTilesPerEntity;
+        size_t numTiles = 0;
+        for (int32_t radius = 0;; radius++)
+        {
+            if (radius > maxRadius)
+            {
+                searched = true;
+                break;
+            }
+
+            // Every entity on this ring is at least this far away along one of the axes.
+            const int32_t ringDistance = std::max(radius * COORDS_XY_STEP - (COORDS_XY_STEP - 1), 0);
+            if (candidates.size() >= count)
+            {
+                std::nth_element(candidates.begin(), candidates.begin() + (count - 1), candidates.end(), closer);
+                if (candidates[count - 1].Distance < ringDistance)
+                {
+                    searched = true;
+                    break;
+                }
+            }
+
+            numTiles += radius == 0 ? 1 : static_cast<size_t>(radius) * 8;
+            if (numTiles > maxTiles)
+                break;
+
+            if (radius == 0)
+            {
+                visitTile(centre.x, centre.y);
+                continue;
+            }
+            for (int32_t tileX = centre.x - radius; tileX <= centre.x + radius; tileX++)
+            {
+                visitTile(tileX, centre.y - radius);
+                visitTile(tileX, centre.y + radius);
+            }
+            for (int32_t tileY = centre.y - radius + 1; tileY < centre.y + radius; tileY++)
+            {
+                visitTile(centre.x - radius, tileY);
+                visitTile(centre.x + radius, tileY);
+            }
+        }
+    }
+
+    if (!searched)
+    {
+        candidates.clear();
+        for (auto* entity : EntityList<T>())
+        {
+            if (entity->x != LOCATION_NULL)
+            {
+                consider(entity);
+            }
+        }
+    }
+
+    const auto numResults = std::min(count, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + numResults, candidates.end(), closer);
+    std::vector<T*> result;
+    result.reserve(numResults);
+    for (size_t i = 0; i < numResults; i++)
+    {
+        result.push_back(candidates[i].Entity);
+    }
+    return result;
+}
+
+/**
+ * Returns the closest entity of type T for which the predicate holds, see GetNearestEntities.
+ */
+template<typename T, typename TDistance, typename TPredicate>
+T* GetNearestEntity(const CoordsXY& loc, int32_t maxDistance, TDistance&& getDistance, TPredicate&& predicate)
+{
+    auto result = GetNearestEntities<T>(loc, 1, maxDistance, getDistance, predicate);
+    return result.empty() ? nullptr : result.front();
+}
+
+template<typename T, typename TDistance> T* GetNearestEntity(const CoordsXY& loc, int32_t maxDistance, TDistance&& getDistance)
+{
+    return GetNearestEntity<T>(loc, maxDistance, getDistance, [](const T*) { return true; });
+}
@@ -25,6 +25,7 @@
 #include "../scenario/Scenario.h"
 #include "Balloon.h"
 #include "Duck.h"
+#include "EntityIdSet.h"
 #include "EntityTweener.h"
 #include "Fountain.h"
 #include "MoneyEffect.h"
@@ -32,6 +33,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <numeric>
 #include <vector>
@@ -47,7 +49,7 @@ union Entity
 };
 
 static Entity _entities[MAX_ENTITIES]{};
-static std::array<std::list<EntityId>, EnumValue(EntityType::Count)> gEntityLists;
+static std::array<EntityIdSet, EnumValue(EntityType::Count)> gEntityLists;
 static std::vector<EntityId> _freeIdList;
 
 static bool _entityFlashingList[MAX_ENTITIES];
@@ -160,7 +162,7 @@ static void ResetFreeIds()
     });
 }
 
-const std::list<EntityId>& GetEntityList(const EntityType id)
+const EntityIdSet& GetEntityList(const EntityType id)
 {
     return gEntityLists[EnumValue(id)];
 }
@@ -202,6 +204,7 @@ void ResetAllEntities()
     ResetEntityLists();
     ResetFreeIds();
     ResetEntitySpatialIndices();
+    ResetEntityChecksumCache();
 }
 
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
@@ -230,6 +233,25 @@ void ResetEntitySpatialIndices()
 
 #ifndef DISABLE_NETWORK
 
+namespace
+{
+    // The memory of an entity at the time it was last serialised for the checksum and the words the
+    // serialised data added to the checksum. Serialise only depends on the memory of the entity, so an
+    // entity that did not change since can add the recorded words without being serialised again.
+    struct EntityChecksumCacheEntry
+    {
+        std::vector<std::byte> Memory;
+        std::vector<uint64_t> Words;
+    };
+} // namespace
+
+static std::vector<EntityChecksumCacheEntry> _entityChecksumCache;
+
+void ResetEntityChecksumCache()
+{
+    _entityChecksumCache.clear();
+}
+
 template<typename T> void NetworkSerialseEntityType(DataSerialiser& ds)
 {
     for (auto* ent : EntityList<T>())
@@ -243,7 +265,49 @@ template<typename... T> void NetworkSerialiseEntityTypes(DataSerialiser& ds)
     (NetworkSerialseEntityType<T>(ds), ...);
 }
 
+template<typename T> void ChecksumEntityType(OpenRCT2::ChecksumStream& ms, DataSerialiser& ds)
+{
+    for (auto* ent : EntityList<T>())
+    {
+        auto& entry = _entityChecksumCache[ent->Id.ToUnderlying()];
+        const auto* memory = reinterpret_cast<const std::byte*>(ent);
+        if (entry.Memory.size() == sizeof(T) && std::memcmp(entry.Memory.data(), memory, sizeof(T)) == 0)
+        {
+            ms.WriteWords(entry.Words);
+            continue;
+        }
+
+        entry.Words.clear();
+        ms.SetRecordedWords(&entry.Words);
+        ent->Serialise(ds);
+        ms.SetRecordedWords(nullptr);
+        entry.Memory.assign(memory, memory + sizeof(T));
+    }
+}
+
+template<typename... T> void ChecksumEntityTypes(OpenRCT2::ChecksumStream& ms, DataSerialiser& ds)
+{
+    (ChecksumEntityType<T>(ms, ds), ...);
+}
+
 EntitiesChecksum GetAllEntitiesChecksum()
+{
+    PROFILED_FUNCTION();
+
+    EntitiesChecksum checksum{};
+
+    _entityChecksumCache.resize(MAX_ENTITIES);
+    OpenRCT2::ChecksumStream ms(checksum.raw);
+    DataSerialiser ds(true, ms);
+    ChecksumEntityTypes<Guest, Staff, Vehicle, Litter>(ms, ds);
+
+#if defined(DEBUG) && DEBUG > 0
+    Guard::Assert(checksum.raw == GetAllEntitiesChecksumFull().raw, "Cached entity checksum differs from the full checksum");
+#endif
+    return checksum;
+}
+
+EntitiesChecksum GetAllEntitiesChecksumFull()
 {
     EntitiesChecksum checksum{};
 
@@ -255,11 +319,20 @@ EntitiesChecksum GetAllEntitiesChecksum()
 }
 #else
 
+void ResetEntityChecksumCache()
+{
+}
+
 EntitiesChecksum GetAllEntitiesChecksum()
 {
     return EntitiesChecksum{};
 }
 
+EntitiesChecksum GetAllEntitiesChecksumFull()
+{
+    return EntitiesChecksum{};
+}
+
 #endif // DISABLE_NETWORK
 
 static void EntityReset(EntityBase* entity)
@@ -278,9 +351,8 @@ static void EntityReset(EntityBase* entity)
 static constexpr uint16_t MAX_MISC_SPRITES = 300;
 static void AddToEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    // Entity list must be in sprite_index order to prevent desync issues
-    list.insert(std::lower_bound(std::begin(list), std::end(list), entity->Id), entity->Id);
+    // Entity lists are iterated in sprite_index order to prevent desync issues
+    gEntityLists[EnumValue(entity->Type)].Insert(entity->Id);
 }
 
 static void AddToFreeList(EntityId index)
@@ -291,12 +363,7 @@ static void AddToFreeList(EntityId index)
 
 static void RemoveFromEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    auto ptr = BinaryFind(std::begin(list), std::end(list), entity->Id);
-    if (ptr != std::end(list))
-    {
-        list.erase(ptr);
-    }
+    gEntityLists[EnumValue(entity->Type)].Remove(entity->Id);
 }
 
 uint16_t GetMiscEntityCount()
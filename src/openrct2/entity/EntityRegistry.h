@@ -64,6 +64,12 @@ struct EntitiesChecksum
 };
 #pragma pack(pop)
 EntitiesChecksum GetAllEntitiesChecksum();
+/**
+ * Serialises every entity again instead of reusing the data of entities that did not change since the
+ * last checksum, gives the same result as GetAllEntitiesChecksum.
+ */
+EntitiesChecksum GetAllEntitiesChecksumFull();
+void ResetEntityChecksumCache();
 
 void EntitySetFlashing(EntityBase* entity, bool flashing);
 bool EntityGetFlashing(EntityBase* entity);
@@ -1833,34 +1833,101 @@ void Guest::PickRideToGoOn()
     }
 }
 
+namespace
+{
+    // Ride data used by guests choosing a ride to go on. None of it changes while guests are updated, so it is gathered
+    // once before they are, instead of every guest walking all rides. Whether the queue of a ride is full and whether
+    // the guest wants to go on it depend on the guests updated before, those are still checked on the ride itself.
+    struct RideCandidates
+    {
+        bool Valid{};
+        OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> Rides;
+        // Rides that can be seen from anywhere in the park
+        OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> TallRides;
+        std::array<uint64_t, OpenRCT2::Limits::MaxRidesInPark> RideTypeFlags{};
+    };
+} // namespace
+
+static RideCandidates _rideCandidates;
+
+void GuestUpdateRideCandidates()
+{
+    _rideCandidates.Rides.reset();
+    _rideCandidates.TallRides.reset();
+    for (auto& ride : GetRideManager())
+    {
+        const auto rideIndex = ride.id.ToUnderlying();
+        _rideCandidates.Rides[rideIndex] = true;
+        _rideCandidates.TallRides[rideIndex] = ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00);
+        _rideCandidates.RideTypeFlags[rideIndex] = ride.GetRideTypeDescriptor().Flags;
+    }
+    _rideCandidates.Valid = true;
+}
+
+void GuestResetRideCandidates()
+{
+    _rideCandidates.Valid = false;
+}
+
+// Guests choosing a ride outside of the guest update get the candidates gathered for them.
+static const RideCandidates& GetRideCandidates()
+{
+    if (!_rideCandidates.Valid)
+    {
+        GuestUpdateRideCandidates();
+        _rideCandidates.Valid = false;
+    }
+    return _rideCandidates;
+}
+
+// Calls func with every ride in the set, in ride id order.
+template<typename TFunc>
+static void ForEachRideInSet(const OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark>& rides, TFunc&& func)
+{
+    using BlockType = OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark>::BlockType;
+    constexpr size_t BitsPerBlock = sizeof(BlockType) * 8;
+    const auto& blocks = rides.data();
+    for (size_t blockIndex = 0; blockIndex < blocks.size(); blockIndex++)
+    {
+        auto bits = static_cast<uint64_t>(blocks[blockIndex]);
+        while (bits != 0)
+        {
+            const auto bit = static_cast<size_t>(UtilBitScanForward(static_cast<int64_t>(bits)));
+            bits &= bits - 1;
+
+            auto* ride = GetRide(RideId::FromUnderlying(static_cast<RideId::UnderlyingType>(blockIndex * BitsPerBlock + bit)));
+            if (ride != nullptr)
+            {
+                func(*ride);
+            }
+        }
+    }
+}
+
 Ride* Guest::FindBestRideToGoOn()
 {
     // Pick the most exciting ride
     auto rideConsideration = FindRidesToGoOn();
     Ride* mostExcitingRide = nullptr;
-    for (auto& ride : GetRideManager())
-    {
-        const auto rideIndex = ride.id.ToUnderlying();
-        if (rideConsideration.size() > rideIndex && rideConsideration[rideIndex])
+    ForEachRideInSet(rideConsideration, [this, &mostExcitingRide](Ride& ride) {
+        if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_QUEUE_FULL))
         {
-            if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_QUEUE_FULL))
+            if (ShouldGoOnRide(ride, StationIndex::FromUnderlying(0), false, true) && RideHasRatings(ride))
             {
-                if (ShouldGoOnRide(ride, StationIndex::FromUnderlying(0), false, true) && RideHasRatings(ride))
+                if (mostExcitingRide == nullptr || ride.excitement > mostExcitingRide->excitement)
                 {
-                    if (mostExcitingRide == nullptr || ride.excitement > mostExcitingRide->excitement)
-                    {
-                        mostExcitingRide = &ride;
-                    }
+                    mostExcitingRide = &ride;
                 }
             }
         }
-    }
+    });
     return mostExcitingRide;
 }
 
 OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> Guest::FindRidesToGoOn()
 {
     OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> rideConsideration;
+    const auto& candidates = GetRideCandidates();
 
     // FIX  Originally checked for a toy, likely a mistake and should be a map,
     //      but then again this seems to only allow the peep to go on
@@ -1868,11 +1935,16 @@ OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> Guest::FindRidesToGoOn()
     if (HasItem(ShopItem::Map))
     {
         // Consider rides that peep hasn't been on yet
-        for (auto& ride : GetRideManager())
+        rideConsideration = candidates.Rides;
+        const auto* ridesBeenOn = OpenRCT2::RideUse::GetHistory().GetAll(Id);
+        if (ridesBeenOn != nullptr)
         {
-            if (!HasRidden(ride))
+            for (auto rideId : *ridesBeenOn)
             {
-                rideConsideration[ride.id.ToUnderlying()] = true;
+                if (rideId.ToUnderlying() < rideConsideration.size())
+                {
+                    rideConsideration[rideId.ToUnderlying()] = false;
+                }
             }
         }
     }
@@ -1902,13 +1974,7 @@ OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> Guest::FindRidesToGoOn()
         }
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
-        for (auto& ride : GetRideManager())
-        {
-            if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
-            {
-                rideConsideration[ride.id.ToUnderlying()] = true;
-            }
-        }
+        rideConsideration |= candidates.TallRides;
     }
 
     return rideConsideration;
@@ -2992,15 +3058,8 @@ static PeepThoughtType PeepAssessSurroundings(int16_t centre_x, int16_t centre_y
         }
     }
 
-    for (auto litter : EntityList<Litter>())
-    {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
-        {
-            num_rubbish++;
-        }
-    }
+    ForEachEntityInRange<Litter>(
+        { centre_x - 160, centre_y - 160, centre_x + 160, centre_y + 160 }, [&num_rubbish](Litter*) { num_rubbish++; });
 
     if (num_fountains >= 5 && num_rubbish < 20)
         return PeepThoughtType::Fountains;
@@ -3116,8 +3175,12 @@ static void PeepLeavePark(Guest* peep)
     WindowInvalidateByNumber(WindowClass::Peep, peep->Id);
 }
 
-template<typename T> static void PeepHeadForNearestRide(Guest* peep, bool considerOnlyCloseRides, T predicate)
+static void PeepHeadForNearestRideWithFlags(Guest* peep, bool considerOnlyCloseRides, int64_t rideTypeFlags)
 {
+    if ((rideTypeFlags & RIDE_TYPE_FLAG_IS_TOILET) && peep->HasFoodOrDrink())
+    {
+        return;
+    }
     if (peep->State != PeepState::Sitting && peep->State != PeepState::Watching && peep->State != PeepState::Walking)
     {
         return;
@@ -3129,21 +3192,26 @@ template<typename T> static void PeepHeadForNearestRide(Guest* peep, bool consid
     if (!peep->GuestHeadingToRideId.IsNull())
     {
         auto ride = GetRide(peep->GuestHeadingToRideId);
-        if (ride != nullptr && predicate(*ride))
+        if (ride != nullptr && ride->GetRideTypeDescriptor().HasFlag(rideTypeFlags))
         {
             return;
         }
     }
 
+    const auto& candidates = GetRideCandidates();
+    const auto hasFlags = [&candidates, rideTypeFlags](RideId::UnderlyingType rideIndex) {
+        return candidates.Rides[rideIndex] && (candidates.RideTypeFlags[rideIndex] & rideTypeFlags) != 0;
+    };
+
     OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> rideConsideration;
     if (!considerOnlyCloseRides && (peep->HasItem(ShopItem::Map)))
     {
         // Consider all rides in the park
-        for (const auto& ride : GetRideManager())
+        for (RideId::UnderlyingType rideIndex = 0; rideIndex < OpenRCT2::Limits::MaxRidesInPark; rideIndex++)
         {
-            if (predicate(ride))
+            if (hasFlags(rideIndex))
             {
-                rideConsideration[ride.id.ToUnderlying()] = true;
+                rideConsideration[rideIndex] = true;
             }
         }
     }
@@ -3164,14 +3232,13 @@ template<typename T> static void PeepHeadForNearestRide(Guest* peep, bool consid
                 for (auto* trackElement : TileElementsView<TrackElement>(location))
                 {
                     auto rideIndex = trackElement->GetRideIndex();
-                    auto ride = GetRide(rideIndex);
-                    if (ride == nullptr)
+                    if (rideIndex.IsNull() || rideIndex.ToUnderlying() >= OpenRCT2::Limits::MaxRidesInPark)
                         continue;
 
-                    if (!predicate(*ride))
+                    if (!hasFlags(rideIndex.ToUnderlying()))
                         continue;
 
-                    rideConsideration[ride->id.ToUnderlying()] = true;
+                    rideConsideration[rideIndex.ToUnderlying()] = true;
                 }
             }
         }
@@ -3180,19 +3247,15 @@ template<typename T> static void PeepHeadForNearestRide(Guest* peep, bool consid
     // Filter the considered rides
     RideId potentialRides[OpenRCT2::Limits::MaxRidesInPark];
     size_t numPotentialRides = 0;
-    for (auto& ride : GetRideManager())
-    {
-        if (rideConsideration[ride.id.ToUnderlying()])
+    ForEachRideInSet(rideConsideration, [peep, &potentialRides, &numPotentialRides](Ride& ride) {
+        if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_QUEUE_FULL))
         {
-            if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_QUEUE_FULL))
+            if (peep->ShouldGoOnRide(ride, StationIndex::FromUnderlying(0), false, true))
             {
-                if (peep->ShouldGoOnRide(ride, StationIndex::FromUnderlying(0), false, true))
-                {
-                    potentialRides[numPotentialRides++] = ride.id;
-                }
+                potentialRides[numPotentialRides++] = ride.id;
             }
         }
-    }
+    });
 
     // Pick the closest ride
     Ride* closestRide{};
@@ -3222,17 +3285,6 @@ template<typename T> static void PeepHeadForNearestRide(Guest* peep, bool consid
     }
 }
 
-static void PeepHeadForNearestRideWithFlags(Guest* peep, bool considerOnlyCloseRides, int64_t rideTypeFlags)
-{
-    if ((rideTypeFlags & RIDE_TYPE_FLAG_IS_TOILET) && peep->HasFoodOrDrink())
-    {
-        return;
-    }
-    PeepHeadForNearestRide(peep, considerOnlyCloseRides, [rideTypeFlags](const Ride& ride) {
-        return ride.GetRideTypeDescriptor().HasFlag(rideTypeFlags);
-    });
-}
-
 /**
  *
  *  rct2: 0x00699FE3
@@ -6218,22 +6270,13 @@ static void PeepUpdateWalkingBreakScenery(Guest* peep)
         return;
     }
 
-    for (auto inner_peep : EntityList<Staff>())
+    for (auto inner_peep : GetEntitiesInRange<Staff>({ peep->x - 223, peep->y - 223, peep->x + 223, peep->y + 223 }))
     {
         if (inner_peep->AssignedStaffType != StaffType::Security)
             continue;
 
-        if (inner_peep->x == LOCATION_NULL)
-            continue;
-
-        int32_t x_diff = abs(inner_peep->x - peep->x);
-        int32_t y_diff = abs(inner_peep->y - peep->y);
-
-        if (std::max(x_diff, y_diff) < 224)
-        {
-            inner_peep->StaffVandalsStopped++;
-            return;
-        }
+        inner_peep->StaffVandalsStopped++;
+        return;
     }
 
     tileElement->SetIsBroken(true);
@@ -261,18 +261,10 @@ struct Guest : Peep
     static constexpr auto cEntityType = EntityType::Guest;
 
 public:
-    uint8_t GuestNumRides;
-    EntityId GuestNextInQueue;
-    int32_t ParkEntryTime;
-    RideId GuestHeadingToRideId;
-    uint8_t GuestIsLostCountdown;
-    uint8_t GuestTimeOnRide;
-    money64 PaidToEnter;
-    money64 PaidOnRides;
-    money64 PaidOnFood;
-    money64 PaidOnDrink;
-    money64 PaidOnSouvenirs;
-    bool OutsideOfPark;
+    // Read and written by the tick update of every guest, kept next to the hot fields at the end of Peep.
+    std::array<PeepThought, PEEP_MAX_THOUGHTS> Thoughts;
+    RideId PreviousRide;
+    uint16_t PreviousRideTimeOut;
     uint8_t Happiness;
     uint8_t HappinessTarget;
     uint8_t Nausea;
@@ -281,20 +273,33 @@ public:
     uint8_t Thirst;
     uint8_t Toilet;
     uint8_t TimeToConsume;
+    uint64_t ItemFlags;
+    bool OutsideOfPark;
+    uint8_t GuestIsLostCountdown;
+    RideId GuestHeadingToRideId;
+    EntityId GuestNextInQueue;
+    uint16_t TimeInQueue;
+    int8_t RejoinQueueTimeout; // whilst waiting for a free vehicle (or pair) in the entrance
+    uint8_t TimeLost; // the time the peep has been lost when it reaches 254 generates the lost thought
+    uint8_t Angriness;
+    uint8_t SurroundingsThoughtTimeout;
+
+    uint8_t GuestNumRides;
+    int32_t ParkEntryTime;
+    uint8_t GuestTimeOnRide;
+    money64 PaidToEnter;
+    money64 PaidOnRides;
+    money64 PaidOnFood;
+    money64 PaidOnDrink;
+    money64 PaidOnSouvenirs;
     IntensityRange Intensity{ 0 };
     PeepNauseaTolerance NauseaTolerance;
-    uint16_t TimeInQueue;
     money64 CashInPocket;
     money64 CashSpent;
     RideId Photo1RideRef;
     RideId Photo2RideRef;
     RideId Photo3RideRef;
     RideId Photo4RideRef;
-
-    int8_t RejoinQueueTimeout; // whilst waiting for a free vehicle (or pair) in the entrance
-    RideId PreviousRide;
-    uint16_t PreviousRideTimeOut;
-    std::array<PeepThought, PEEP_MAX_THOUGHTS> Thoughts;
     // 0x3F Litter Count split into lots of 3 with time, 0xC0 Time since last recalc
     uint8_t LitterCount;
     // 0x3F Sick Count split into lots of 3 with time, 0xC0 Time since last recalc
@@ -309,16 +314,12 @@ public:
         RideId VoucherRideId;
         ShopItemIndex VoucherShopItem;
     };
-    uint8_t SurroundingsThoughtTimeout;
-    uint8_t Angriness;
-    uint8_t TimeLost; // the time the peep has been lost when it reaches 254 generates the lost thought
     uint8_t DaysInQueue;
     uint8_t BalloonColour;
     uint8_t UmbrellaColour;
     uint8_t HatColour;
     RideId FavouriteRide;
     uint8_t FavouriteRideRating;
-    uint64_t ItemFlags;
 
     void UpdateGuest();
     void Tick128UpdateGuest(int32_t index);
@@ -430,6 +431,9 @@ private:
 void UpdateRideApproachVehicleWaypointsMotionSimulator(Guest&, const CoordsXY&, int16_t&);
 void UpdateRideApproachVehicleWaypointsDefault(Guest&, const CoordsXY&, int16_t&);
 
+void GuestUpdateRideCandidates();
+void GuestResetRideCandidates();
+
 static_assert(sizeof(Guest) <= 512);
 
 enum
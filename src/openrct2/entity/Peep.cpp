@@ -211,6 +211,8 @@ void PeepUpdateAll()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    GuestUpdateRideCandidates();
+
     int32_t i = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Guest>())
@@ -231,6 +233,7 @@ void PeepUpdateAll()
 
         i++;
     }
+    GuestResetRideCandidates();
 
     for (auto staff : EntityList<Staff>())
     {
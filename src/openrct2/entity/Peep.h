@@ -310,7 +310,19 @@ struct Staff;
 
 struct Peep : EntityBase
 {
+    // Fields that are rarely used by the tick update come first, the fields below them are read or written every tick
+    // by the action, walking and pathing code. Keeping those together places them on the same cache lines as the hot
+    // fields at the start of Guest and Staff.
     char* Name;
+    uint32_t PeepId;
+    uint8_t TshirtColour;
+    uint8_t TrousersColour;
+    uint8_t Var37;
+    uint8_t Mass;
+    RideId InteractionRideIndex;
+    TileCoordsXYZD PathfindGoal;
+    std::array<TileCoordsXYZD, 4> PathfindHistory;
+
     CoordsXYZ NextLoc;
     uint8_t NextFlags;
     PeepState State;
@@ -322,16 +334,29 @@ struct Peep : EntityBase
         PeepUsingBinSubState UsingBinSubState;
     };
     PeepSpriteType SpriteType;
-    uint8_t TshirtColour;
-    uint8_t TrousersColour;
-    uint16_t DestinationX; // Location that the peep is trying to get to
-    uint16_t DestinationY;
-    uint8_t DestinationTolerance; // How close to destination before next action/state 0 = exact
-    uint8_t Var37;
+    PeepActionSpriteType ActionSpriteType;
+    // Seems to be used like a local variable, as it's always set before calling SwitchNextActionSpriteType, which
+    // reads this again
+    PeepActionSpriteType NextActionSpriteType;
+    uint8_t ActionSpriteImageOffset;
+    PeepActionType Action;
+    uint8_t ActionFrame;
+    uint8_t StepProgress;
+    union
+    {
+        uint8_t MazeLastEdge;
+        ::Direction PeepDirection; // Direction ?
+    };
+    uint8_t WalkingFrameNum;
     uint8_t Energy;
     uint8_t EnergyTarget;
-    uint8_t Mass;
+    uint8_t PathCheckOptimisation; // see peep.checkForPath
+    // Normally 0, 1 for carrying sliding board on spiral slide ride, 2 for carrying lawn mower
+    uint8_t SpecialSprite;
     uint8_t WindowInvalidateFlags;
+    uint16_t DestinationX; // Location that the peep is trying to get to
+    uint16_t DestinationY;
+    uint8_t DestinationTolerance; // How close to destination before next action/state 0 = exact
     RideId CurrentRide;
     StationIndex CurrentRideStation;
     uint8_t CurrentTrain;
@@ -349,27 +374,6 @@ struct Peep : EntityBase
             uint8_t StandingFlags;
         };
     };
-    // Normally 0, 1 for carrying sliding board on spiral slide ride, 2 for carrying lawn mower
-    uint8_t SpecialSprite;
-    PeepActionSpriteType ActionSpriteType;
-    // Seems to be used like a local variable, as it's always set before calling SwitchNextActionSpriteType, which
-    // reads this again
-    PeepActionSpriteType NextActionSpriteType;
-    uint8_t ActionSpriteImageOffset;
-    PeepActionType Action;
-    uint8_t ActionFrame;
-    uint8_t StepProgress;
-    union
-    {
-        uint8_t MazeLastEdge;
-        ::Direction PeepDirection; // Direction ?
-    };
-    RideId InteractionRideIndex;
-    uint32_t PeepId;
-    uint8_t PathCheckOptimisation; // see peep.checkForPath
-    TileCoordsXYZD PathfindGoal;
-    std::array<TileCoordsXYZD, 4> PathfindHistory;
-    uint8_t WalkingFrameNum;
     uint32_t PeepFlags;
 
 public: // Peep
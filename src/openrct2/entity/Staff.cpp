@@ -332,20 +332,10 @@ bool Staff::HasPatrolArea() const
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
-    uint16_t nearestLitterDist = 0xFFFF;
-    Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
-    {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
-
-        if (distance < nearestLitterDist)
-        {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
-        }
-    }
-
-    if (nearestLitterDist > MAX_LITTER_DISTANCE)
+    const auto* nearestLitter = GetNearestEntity<Litter>({ x, y }, MAX_LITTER_DISTANCE, [this](const Litter* litter) {
+        return abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
+    });
+    if (nearestLitter == nullptr)
     {
         return INVALID_DIRECTION;
     }
@@ -889,23 +879,10 @@ bool Staff::IsMechanicHeadingToFixRideBlockingPath()
  */
 void Staff::EntertainerUpdateNearbyPeeps() const
 {
-    for (auto guest : EntityList<Guest>())
-    {
-        if (guest->x == LOCATION_NULL)
-            continue;
-
+    ForEachEntityInRange<Guest>({ x - 96, y - 96, x + 96, y + 96 }, [this](Guest* guest) {
         int16_t z_dist = abs(z - guest->z);
         if (z_dist > 48)
-            continue;
-
-        int16_t x_dist = abs(x - guest->x);
-        int16_t y_dist = abs(y - guest->y);
-
-        if (x_dist > 96)
-            continue;
-
-        if (y_dist > 96)
-            continue;
+            return;
 
         if (guest->State == PeepState::Walking)
         {
@@ -916,7 +893,7 @@ void Staff::EntertainerUpdateNearbyPeeps() const
             guest->TimeInQueue = std::max(0, guest->TimeInQueue - 200);
             guest->HappinessTarget = std::min(guest->HappinessTarget + 3, PEEP_MAX_HAPPINESS);
         }
-    }
+    });
 }
 
 /**
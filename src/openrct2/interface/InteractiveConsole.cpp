@@ -51,6 +51,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
+#include "../paint/Painter.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
@@ -1426,6 +1427,23 @@ static int32_t ConsoleCommandShowLimits(InteractiveConsole& console, [[maybe_unu
     return 0;
 }
 
+static int32_t ConsoleCommandShowPaintStats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    auto* painter = OpenRCT2::GetContext()->GetPainter();
+    if (painter == nullptr)
+    {
+        console.WriteLineError("No painter available.");
+        return 1;
+    }
+
+    const auto stats = painter->GetSessionStats();
+    console.WriteFormatLine("Paint sessions: %zu (peak in use: %zu)", stats.Sessions, stats.PeakSessionsInUse);
+    console.WriteFormatLine("Paint entry nodes: %zu", stats.EntryNodes);
+    console.WriteFormatLine(
+        "Paint entries per session: %zu last frame, %zu peak", stats.LastFramePeakEntries, stats.PeakEntries);
+    return 0;
+}
+
 static int32_t ConsoleCommandForceDate([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     int32_t year = 0;
@@ -2024,6 +2042,7 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "say", ConsoleCommandSay, "Say to other players.", "say <message>" },
     { "set", ConsoleCommandSet, "Sets the variable to the specified value.", "set <variable> <value>" },
     { "show_limits", ConsoleCommandShowLimits, "Shows the map data counts and limits.", "show_limits" },
+    { "show_paint_stats", ConsoleCommandShowPaintStats, "Shows the paint session pool usage.", "show_paint_stats" },
     { "spawn_balloon", ConsoleSpawnBalloon, "Spawns a balloon.", "spawn_balloon <x> <y> <z> <colour>" },
     { "staff", ConsoleCommandStaff, "Staff management.", "staff <subcommand>" },
     { "terminate", ConsoleCommandTerminate, "Calls std::terminate(), for testing purposes only.", "terminate" },
@@ -17,6 +17,7 @@
 #include "../PlatformEnvironment.h"
 #include "../actions/CheatSetAction.h"
 #include "../audio/audio.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/Imaging.h"
@@ -38,9 +39,12 @@
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <iostream>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -325,7 +329,8 @@ static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
     return viewport;
 }
 
-static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewport, DrawPixelInfo& dpi)
+static void RenderViewport(
+    IDrawingEngine* drawingEngine, const Viewport& viewport, DrawPixelInfo& dpi, bool useMultithreading)
 {
     // Ensure sprites appear regardless of rotation
     ResetAllSpriteQuadrantPlacements();
@@ -337,7 +342,7 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewpo
         drawingEngine = tempDrawingEngine.get();
     }
     dpi.DrawingEngine = drawingEngine;
-    ViewportRender(dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
+    ViewportRender(dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } }, useMultithreading);
 }
 
 void ScreenshotGiant()
@@ -372,7 +377,7 @@ void ScreenshotGiant()
 
         dpi = CreateDPI(viewport);
 
-        RenderViewport(nullptr, viewport, dpi);
+        RenderViewport(nullptr, viewport, dpi, gConfigGeneral.MultiThreading);
         WriteDpiToFile(path.value(), dpi, gPalette);
 
         // Show user that screenshot saved successfully
@@ -391,23 +396,14 @@ void ScreenshotGiant()
     ReleaseDPI(dpi);
 }
 
-static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
+// Changes the park, only needs to be done once after loading it.
+static void ApplyParkOptions(const ScreenshotOptions* options)
 {
     if (options->weather != WeatherType::Sunny && options->weather != WeatherType::Count)
     {
         ClimateForceWeather(WeatherType{ static_cast<uint8_t>(EnumValue(options->weather) - 1) });
     }
 
-    if (options->hide_guests)
-    {
-        viewport.flags |= VIEWPORT_FLAG_HIDE_GUESTS | VIEWPORT_FLAG_HIDE_STAFF;
-    }
-
-    if (options->hide_sprites)
-    {
-        viewport.flags |= VIEWPORT_FLAG_HIDE_ENTITIES;
-    }
-
     if (options->mowed_grass)
     {
         CheatsSet(CheatType::SetGrassLength, GRASS_LENGTH_MOWED);
@@ -432,6 +428,19 @@ static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
     {
         CheatsSet(CheatType::RemoveLitter);
     }
+}
+
+static void ApplyViewportOptions(const ScreenshotOptions* options, Viewport& viewport)
+{
+    if (options->hide_guests)
+    {
+        viewport.flags |= VIEWPORT_FLAG_HIDE_GUESTS | VIEWPORT_FLAG_HIDE_STAFF;
+    }
+
+    if (options->hide_sprites)
+    {
+        viewport.flags |= VIEWPORT_FLAG_HIDE_ENTITIES;
+    }
 
     if (options->transparent || gConfigGeneral.TransparentScreenshot)
     {
@@ -439,7 +448,13 @@ static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
     }
 }
 
-int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
+static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
+{
+    ApplyParkOptions(options);
+    ApplyViewportOptions(options, viewport);
+}
+
+static int32_t GetScreenshotArgumentCount(const char** argv, int32_t argc)
 {
     // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
     for (int32_t i = 0; i < argc; i++)
@@ -447,16 +462,116 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
         if (argv[i][0] == '-')
         {
             // Setting argc to i works, because options can only be at the end of the command
-            argc = i;
-            break;
+            return i;
         }
     }
+    return argc;
+}
 
-    bool giantScreenshot = (argc == 5) && String::IEquals(argv[2], "giant");
-    if (argc != 4 && argc != 8 && !giantScreenshot)
+static bool IsGiantScreenshot(const char** argv, int32_t argc)
+{
+    return (argc == 5) && String::IEquals(argv[2], "giant");
+}
+
+static bool AreValidScreenshotArguments(const char** argv, int32_t argc)
+{
+    return argc == 4 || argc == 8 || IsGiantScreenshot(argv, argc);
+}
+
+/**
+ * Creates the viewport described by the screenshot arguments for the loaded park and sets the matching rotation.
+ */
+static Viewport GetScreenshotViewport(const char** argv, int32_t argc)
+{
+    Viewport viewport{};
+    if (IsGiantScreenshot(argv, argc))
+    {
+        auto customZoom = static_cast<int8_t>(std::atoi(argv[3]));
+        auto zoom = ZoomLevel{ customZoom };
+        auto rotation = std::atoi(argv[4]) & 3;
+        viewport = GetGiantViewport(rotation, zoom);
+        gCurrentRotation = rotation;
+        return viewport;
+    }
+
+    bool customLocation = false;
+    bool centreMapX = false;
+    bool centreMapY = false;
+    int32_t resolutionWidth = std::atoi(argv[2]);
+    int32_t resolutionHeight = std::atoi(argv[3]);
+    int32_t customX = 0;
+    int32_t customY = 0;
+    int32_t customZoom = 0;
+    int32_t customRotation = 0;
+    if (argc == 8)
+    {
+        customLocation = true;
+        if (argv[4][0] == 'c')
+            centreMapX = true;
+        else
+            customX = std::atoi(argv[4]);
+
+        if (argv[5][0] == 'c')
+            centreMapY = true;
+        else
+            customY = std::atoi(argv[5]);
+
+        customZoom = std::atoi(argv[6]);
+        customRotation = std::atoi(argv[7]) & 3;
+    }
+
+    const auto& mapSize = gMapSize;
+    if (resolutionWidth == 0 || resolutionHeight == 0)
+    {
+        resolutionWidth = (mapSize.x * COORDS_XY_STEP * 2) >> customZoom;
+        resolutionHeight = (mapSize.y * COORDS_XY_STEP * 1) >> customZoom;
+
+        resolutionWidth += 8;
+        resolutionHeight += 128;
+    }
+
+    viewport.width = resolutionWidth;
+    viewport.height = resolutionHeight;
+    viewport.view_width = viewport.width;
+    viewport.view_height = viewport.height;
+    if (customLocation)
+    {
+        if (centreMapX)
+            customX = (mapSize.x / 2) * 32 + 16;
+        if (centreMapY)
+            customY = (mapSize.y / 2) * 32 + 16;
+
+        int32_t z = TileElementHeight({ customX, customY });
+        CoordsXYZ coords3d = { customX, customY, z };
+
+        auto coords2d = Translate3DTo2DWithZ(customRotation, coords3d);
+
+        viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
+                             coords2d.y - ((viewport.view_height << customZoom) / 2) };
+        viewport.zoom = ZoomLevel{ static_cast<int8_t>(customZoom) };
+        gCurrentRotation = customRotation;
+    }
+    else
+    {
+        viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
+        viewport.zoom = gSavedViewZoom;
+        gCurrentRotation = gSavedViewRotation;
+    }
+    return viewport;
+}
+
+static void PrintScreenshotUsage()
+{
+    std::printf("Usage: openrct2 screenshot <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
+    std::printf("Usage: openrct2 screenshot <file> <output_image> giant <zoom> <rotation>\n");
+}
+
+int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
+{
+    argc = GetScreenshotArgumentCount(argv, argc);
+    if (!AreValidScreenshotArguments(argv, argc))
     {
-        std::printf("Usage: openrct2 screenshot <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
-        std::printf("Usage: openrct2 screenshot <file> <output_image> giant <zoom> <rotation>\n");
+        PrintScreenshotUsage();
         return -1;
     }
 
@@ -464,10 +579,6 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
     DrawPixelInfo dpi;
     try
     {
-        bool customLocation = false;
-        bool centreMapX = false;
-        bool centreMapY = false;
-
         const char* inputPath = argv[0];
         const char* outputPath = argv[1];
 
@@ -488,96 +599,212 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
         gIntroState = IntroState::None;
         gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-        Viewport viewport{};
-        if (giantScreenshot)
+        auto viewport = GetScreenshotViewport(argv, argc);
+        ApplyOptions(options, viewport);
+
+        dpi = CreateDPI(viewport);
+
+        RenderViewport(nullptr, viewport, dpi, gConfigGeneral.MultiThreading);
+        WriteDpiToFile(outputPath, dpi, gPalette);
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        exitCode = -1;
+    }
+    ReleaseDPI(dpi);
+
+    DrawingEngineDispose();
+
+    return exitCode;
+}
+
+/**
+ * Splits a job line into its arguments. Arguments are separated by whitespace, double quotes can be used for paths
+ * that contain spaces.
+ */
+static std::vector<std::string> SplitScreenshotJob(std::string_view line)
+{
+    std::vector<std::string> arguments;
+    std::string argument;
+    bool inArgument = false;
+    bool inQuotes = false;
+    for (auto c : line)
+    {
+        if (c == '"')
         {
-            auto customZoom = static_cast<int8_t>(std::atoi(argv[3]));
-            auto zoom = ZoomLevel{ customZoom };
-            auto rotation = std::atoi(argv[4]) & 3;
-            viewport = GetGiantViewport(rotation, zoom);
-            gCurrentRotation = rotation;
+            inQuotes = !inQuotes;
+            inArgument = true;
         }
-        else
+        else if (!inQuotes && std::isspace(static_cast<unsigned char>(c)))
         {
-            int32_t resolutionWidth = std::atoi(argv[2]);
-            int32_t resolutionHeight = std::atoi(argv[3]);
-            int32_t customX = 0;
-            int32_t customY = 0;
-            int32_t customZoom = 0;
-            int32_t customRotation = 0;
-            if (argc == 8)
+            if (inArgument)
             {
-                customLocation = true;
-                if (argv[4][0] == 'c')
-                    centreMapX = true;
-                else
-                    customX = std::atoi(argv[4]);
-
-                if (argv[5][0] == 'c')
-                    centreMapY = true;
-                else
-                    customY = std::atoi(argv[5]);
-
-                customZoom = std::atoi(argv[6]);
-                customRotation = std::atoi(argv[7]) & 3;
+                arguments.push_back(std::move(argument));
+                argument.clear();
+                inArgument = false;
             }
+        }
+        else
+        {
+            argument.push_back(c);
+            inArgument = true;
+        }
+    }
+    if (inArgument)
+    {
+        arguments.push_back(std::move(argument));
+    }
+    return arguments;
+}
 
-            const auto& mapSize = gMapSize;
-            if (resolutionWidth == 0 || resolutionHeight == 0)
-            {
-                resolutionWidth = (mapSize.x * COORDS_XY_STEP * 2) >> customZoom;
-                resolutionHeight = (mapSize.y * COORDS_XY_STEP * 1) >> customZoom;
+static double GetElapsedMilliseconds(std::chrono::high_resolution_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
 
-                resolutionWidth += 8;
-                resolutionHeight += 128;
-            }
+namespace
+{
+    // The park file a screenshot server job renders, the park is loaded again when the file changed since.
+    struct ScreenshotParkFile
+    {
+        std::string Path;
+        uint64_t LastModified{};
+        uint64_t Size{};
 
-            viewport.width = resolutionWidth;
-            viewport.height = resolutionHeight;
-            viewport.view_width = viewport.width;
-            viewport.view_height = viewport.height;
-            if (customLocation)
-            {
-                if (centreMapX)
-                    customX = (mapSize.x / 2) * 32 + 16;
-                if (centreMapY)
-                    customY = (mapSize.y / 2) * 32 + 16;
+        bool operator==(const ScreenshotParkFile& other) const
+        {
+            return Path == other.Path && LastModified == other.LastModified && Size == other.Size;
+        }
+        bool operator!=(const ScreenshotParkFile& other) const
+        {
+            return !(*this == other);
+        }
+    };
+} // namespace
 
-                int32_t z = TileElementHeight({ customX, customY });
-                CoordsXYZ coords3d = { customX, customY, z };
+static ScreenshotParkFile GetScreenshotParkFile(const std::string& path)
+{
+    return { path, File::GetLastModified(path), File::GetSize(path) };
+}
 
-                auto coords2d = Translate3DTo2DWithZ(customRotation, coords3d);
+int32_t CommandLineForScreenshotServer(const char* jobsPath, ScreenshotOptions* options)
+{
+    std::ifstream jobsFile;
+    if (jobsPath != nullptr && !String::Equals(jobsPath, "-"))
+    {
+        jobsFile.open(fs::u8path(jobsPath));
+        if (!jobsFile.is_open())
+        {
+            std::printf("Unable to open '%s'.\n", jobsPath);
+            return -1;
+        }
+    }
+    std::istream& jobs = jobsFile.is_open() ? jobsFile : std::cin;
 
-                viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
-                                     coords2d.y - ((viewport.view_height << customZoom) / 2) };
-                viewport.zoom = ZoomLevel{ static_cast<int8_t>(customZoom) };
-                gCurrentRotation = customRotation;
-            }
-            else
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        std::printf("Failed to initialize context.\n");
+        return -1;
+    }
+
+    DrawingEngineInit();
+
+    // Kept for every job, so sprites that were decoded once stay cached while the park stays the same.
+    X8DrawingEngine drawingEngine(context->GetUiContext());
+
+    ScreenshotParkFile loadedPark;
+    int32_t numJobs = 0;
+    int32_t numFailed = 0;
+    const auto serverStart = std::chrono::high_resolution_clock::now();
+
+    std::string line;
+    while (std::getline(jobs, line))
+    {
+        auto arguments = SplitScreenshotJob(line);
+        if (arguments.empty() || arguments[0][0] == '#')
+        {
+            continue;
+        }
+
+        numJobs++;
+        std::vector<const char*> argv;
+        for (const auto& argument : arguments)
+        {
+            argv.push_back(argument.c_str());
+        }
+        const auto argc = static_cast<int32_t>(argv.size());
+        if (!AreValidScreenshotArguments(argv.data(), argc))
+        {
+            std::printf("job %d: failed, invalid arguments\n", numJobs);
+            std::fflush(stdout);
+            numFailed++;
+            continue;
+        }
+
+        DrawPixelInfo dpi{};
+        try
+        {
+            // Parks are only reloaded when they change, consecutive jobs for the same park render other views of it.
+            auto start = std::chrono::high_resolution_clock::now();
+            const auto parkFile = GetScreenshotParkFile(arguments[0]);
+            if (parkFile != loadedPark)
             {
-                viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
-                viewport.zoom = gSavedViewZoom;
-                gCurrentRotation = gSavedViewRotation;
+                // Loading the objects of another park assigns their images again. Image invalidations only reach the
+                // drawing engine of the context, not this one.
+                drawingEngine.GetSpriteCache().Clear();
+
+                loadedPark = {};
+                if (!context->LoadParkFromFile(arguments[0]))
+                {
+                    throw std::runtime_error("Failed to load park.");
+                }
+                loadedPark = parkFile;
+
+                gIntroState = IntroState::None;
+                gScreenFlags = SCREEN_FLAGS_PLAYING;
+                ApplyParkOptions(options);
             }
-        }
+            const auto loadTime = GetElapsedMilliseconds(start);
 
-        ApplyOptions(options, viewport);
+            start = std::chrono::high_resolution_clock::now();
+            auto viewport = GetScreenshotViewport(argv.data(), argc);
+            ApplyViewportOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
+            dpi = CreateDPI(viewport);
+            RenderViewport(&drawingEngine, viewport, dpi, true);
+            const auto renderTime = GetElapsedMilliseconds(start);
 
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, dpi, gPalette);
-    }
-    catch (const std::exception& e)
-    {
-        std::printf("%s\n", e.what());
-        exitCode = -1;
+            start = std::chrono::high_resolution_clock::now();
+            if (!WriteDpiToFile(arguments[1], dpi, gPalette))
+            {
+                throw std::runtime_error("Failed to write image.");
+            }
+            const auto writeTime = GetElapsedMilliseconds(start);
+
+            std::printf(
+                "job %d: %s (%dx%d), load %.2f ms, render %.2f ms, write %.2f ms\n", numJobs, arguments[1].c_str(),
+                viewport.width, viewport.height, loadTime, renderTime, writeTime);
+        }
+        catch (const std::exception& e)
+        {
+            std::printf("job %d: failed, %s\n", numJobs, e.what());
+            numFailed++;
+        }
+        ReleaseDPI(dpi);
+
+        // Whoever queues the jobs may be waiting for this one before sending the next.
+        std::fflush(stdout);
     }
-    ReleaseDPI(dpi);
+
+    std::printf(
+        "Rendered %d of %d jobs in %.2f ms\n", numJobs - numFailed, numJobs, GetElapsedMilliseconds(serverStart));
 
     DrawingEngineDispose();
 
-    return exitCode;
+    return numFailed == 0 ? 1 : -1;
 }
 
 static bool IsPathChildOf(fs::path x, const fs::path& parent)
@@ -661,7 +888,7 @@ void CaptureImage(const CaptureOptions& options)
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
     auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
+    RenderViewport(nullptr, viewport, dpi, gConfigGeneral.MultiThreading);
     WriteDpiToFile(outputPath, dpi, gPalette);
     ReleaseDPI(dpi);
 
@@ -62,7 +62,8 @@ static std::list<Viewport> _viewports;
 Viewport* g_music_tracking_viewport;
 
 static std::unique_ptr<JobPool> _paintJobs;
-static std::vector<PaintSession*> _paintColumns;
+// The drawing engine can render the main viewport from several threads, each painting a part of the screen.
+static thread_local std::vector<PaintSession*> _paintColumns;
 
 ScreenCoordsXY gSavedView;
 ZoomLevel gSavedViewZoom;
@@ -806,7 +807,7 @@ void ViewportUpdateSmartFollowVehicle(WindowBase* window)
  *  edi: dpi
  *  ebp: bottom
  */
-void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRect& screenRect)
+void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRect& screenRect, bool useMultithreading)
 {
     auto [topLeft, bottomRight] = screenRect;
 
@@ -836,7 +837,7 @@ void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRe
         viewport->zoom.ApplyTo(std::min(bottomRight.y, viewport->height)),
     } + viewport->viewPos;
 
-    ViewportPaint(viewport, dpi, { topLeft, bottomRight });
+    ViewportPaint(viewport, dpi, { topLeft, bottomRight }, useMultithreading);
 
 #ifdef DEBUG_SHOW_DIRTY_BOX
     // FIXME g_viewport_list doesn't exist anymore
@@ -894,7 +895,7 @@ static void ViewportPaintColumn(PaintSession& session)
  *  edi: dpi
  *  ebp: bottom
  */
-void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect)
+void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect, bool useMultithreading)
 {
     PROFILED_FUNCTION();
 
@@ -934,17 +935,15 @@ void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRec
     auto rightBorder = dpi1.x + dpi1.width;
     auto alignedX = Floor2(dpi1.x, 32);
 
-    _paintColumns.clear();
+    auto& paintColumns = _paintColumns;
+    paintColumns.clear();
 
-    bool useMultithreading = gConfigGeneral.MultiThreading;
+    // Only the thread that owns the paint jobs may ask for multithreading, the drawing engine turns it off when
+    // it already renders several parts of a viewport at once.
     if (useMultithreading && _paintJobs == nullptr)
     {
         _paintJobs = std::make_unique<JobPool>();
     }
-    else if (useMultithreading == false && _paintJobs != nullptr)
-    {
-        _paintJobs.reset();
-    }
 
     bool useParallelDrawing = false;
     if (useMultithreading && (dpi.DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
@@ -956,7 +955,7 @@ void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRec
     for (x = alignedX; x < rightBorder; x += 32)
     {
         PaintSession* session = PaintSessionAlloc(dpi1, viewFlags);
-        _paintColumns.push_back(session);
+        paintColumns.push_back(session);
 
         DrawPixelInfo& dpi2 = session->DPI;
         if (x >= dpi2.x)
@@ -976,41 +975,35 @@ void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRec
             dpi2.pitch += dpi2.zoom_level.ApplyInversedTo(rightPitch);
         }
         dpi2.width = paintRight - dpi2.x;
+    }
 
-        if (useMultithreading)
-        {
-            _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
-        }
-        else
+    if (useMultithreading)
+    {
+        _paintJobs->ParallelFor(paintColumns.size(), [&paintColumns](size_t i) { ViewportFillColumn(*paintColumns[i]); });
+    }
+    else
+    {
+        for (auto* session : paintColumns)
         {
             ViewportFillColumn(*session);
         }
     }
 
-    if (useMultithreading)
+    // Paint columns.
+    if (useParallelDrawing)
     {
-        _paintJobs->Join();
+        _paintJobs->ParallelFor(paintColumns.size(), [&paintColumns](size_t i) { ViewportPaintColumn(*paintColumns[i]); });
     }
-
-    // Paint columns.
-    for (auto* session : _paintColumns)
+    else
     {
-        if (useParallelDrawing)
-        {
-            _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
-        }
-        else
+        for (auto* session : paintColumns)
         {
             ViewportPaintColumn(*session);
         }
     }
-    if (useParallelDrawing)
-    {
-        _paintJobs->Join();
-    }
 
     // Release resources.
-    for (auto* session : _paintColumns)
+    for (auto* session : paintColumns)
     {
         PaintSessionFree(session);
     }
@@ -53,6 +53,9 @@ uint16_t gWindowUpdateTicks;
 uint16_t gWindowMapFlashingFlags;
 colour_t gCurrentWindowColours[4];
 
+// Set while drawing over a main viewport that has already been rendered.
+static bool _windowSkipMainViewport = false;
+
 // converted from uint16_t values at 0x009A41EC - 0x009A4230
 // these are percentage coordinates of the viewport to centre to, if a window is obscuring a location, the next is tried
 // clang-format off
@@ -1231,6 +1234,9 @@ static void WindowDrawSingle(DrawPixelInfo& dpi, WindowBase& w, int32_t left, in
             return;
     }
 
+    if (_windowSkipMainViewport && w.classification == WindowClass::MainWindow)
+        return;
+
     // Invalidate modifies the window colours so first get the correct
     // colour before setting the global variables for the string painting
     WindowEventOnPrepareDrawCall(&w);
@@ -1253,7 +1259,8 @@ static void WindowDrawSingle(DrawPixelInfo& dpi, WindowBase& w, int32_t left, in
  */
 void WindowDrawViewport(DrawPixelInfo& dpi, WindowBase& w)
 {
-    ViewportRender(dpi, w.viewport, { { dpi.x, dpi.y }, { dpi.x + dpi.width, dpi.y + dpi.height } });
+    ViewportRender(
+        dpi, w.viewport, { { dpi.x, dpi.y }, { dpi.x + dpi.width, dpi.y + dpi.height } }, gConfigGeneral.MultiThreading);
 }
 
 void WindowSetPosition(WindowBase& w, const ScreenCoordsXY& screenCoords)
@@ -1964,6 +1971,17 @@ void WindowDrawAll(DrawPixelInfo& dpi, int32_t left, int32_t top, int32_t right,
     });
 }
 
+/**
+ * Draws everything in the given region except the main window, whose viewport has already been rendered there
+ * with ViewportRender. Transparent windows on top of the main window are still drawn over it.
+ */
+void WindowDrawAllAboveMainViewport(DrawPixelInfo& dpi, int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    _windowSkipMainViewport = true;
+    WindowDrawAll(dpi, left, top, right, bottom);
+    _windowSkipMainViewport = false;
+}
+
 Viewport* WindowGetPreviousViewport(Viewport* current)
 {
     bool foundPrevious = (current == nullptr);
@@ -587,6 +587,7 @@ void WindowZoomOut(WindowBase& w, bool atCursor);
 void MainWindowZoom(bool zoomIn, bool atCursor);
 
 void WindowDrawAll(DrawPixelInfo& dpi, int32_t left, int32_t top, int32_t right, int32_t bottom);
+void WindowDrawAllAboveMainViewport(DrawPixelInfo& dpi, int32_t left, int32_t top, int32_t right, int32_t bottom);
 void WindowDraw(DrawPixelInfo& dpi, WindowBase& w, int32_t left, int32_t top, int32_t right, int32_t bottom);
 void WindowDrawWidgets(WindowBase& w, DrawPixelInfo& dpi);
 void WindowDrawViewport(DrawPixelInfo& dpi, WindowBase& w);
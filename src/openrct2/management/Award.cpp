@@ -15,14 +15,15 @@
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
 #include "../profiling/Profiling.h"
-#include "../ride/Ride.h"
-#include "../ride/RideData.h"
 #include "../scenario/Scenario.h"
 #include "../world/Park.h"
+#include "../world/ParkStatistics.h"
 #include "NewsItem.h"
 
 #include <algorithm>
 
+using namespace OpenRCT2;
+
 constexpr uint8_t NEGATIVE = 0;
 constexpr uint8_t POSITIVE = 1;
 
@@ -80,8 +81,14 @@ bool AwardIsPositive(AwardType type)
 
 #pragma region Award checks
 
+static uint32_t GetUntidyThoughtCount(const ParkStatistics& stats)
+{
+    return stats.GetFreshThoughtCount(PeepThoughtType::BadLitter) + stats.GetFreshThoughtCount(PeepThoughtType::PathDisgusting)
+        + stats.GetFreshThoughtCount(PeepThoughtType::Vandalism);
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
-static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
+static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostBeautiful))
         return false;
@@ -90,87 +97,29 @@ static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
-    return (negativeCount > gNumGuestsInPark / 16);
+    return (GetUntidyThoughtCount(stats) > gNumGuestsInPark / 16);
 }
 
 /** More than 1/64 of the total guests must be thinking tidy thoughts and less than 6 guests thinking untidy thoughts. */
-static bool AwardIsDeservedMostTidy(int32_t activeAwardTypes)
+static bool AwardIsDeservedMostTidy(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
-    return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
+    const auto positiveCount = stats.GetFreshThoughtCount(PeepThoughtType::VeryClean);
+    return (GetUntidyThoughtCount(stats) <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
 /** At least 6 open roller coasters. */
-static bool AwardIsDeservedBestRollercoasters([[maybe_unused]] int32_t activeAwardTypes)
+static bool AwardIsDeservedBestRollercoasters([[maybe_unused]] int32_t activeAwardTypes, const ParkStatistics& stats)
 {
-    auto rollerCoasters = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_ROLLERCOASTER))
-        {
-            continue;
-        }
-
-        rollerCoasters++;
-    }
-    return (rollerCoasters >= 6);
+    return (stats.RollerCoasters >= 6);
 }
 
 /** Entrance fee is 0.10 less than half of the total ride value. */
-static bool AwardIsDeservedBestValue(int32_t activeAwardTypes)
+static bool AwardIsDeservedBestValue(int32_t activeAwardTypes, [[maybe_unused]] const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::WorstValue))
         return false;
@@ -191,40 +140,19 @@ static bool AwardIsDeservedBestValue(int32_t activeAwardTypes)
 }
 
 /** More than 1/128 of the total guests must be thinking scenic thoughts and fewer than 16 untidy thoughts. */
-static bool AwardIsDeservedMostBeautiful(int32_t activeAwardTypes)
+static bool AwardIsDeservedMostBeautiful(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
-    return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
+    const auto positiveCount = stats.GetFreshThoughtCount(PeepThoughtType::Scenery);
+    return (GetUntidyThoughtCount(stats) <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
 /** Entrance fee is more than total ride value. */
-static bool AwardIsDeservedWorstValue(int32_t activeAwardTypes)
+static bool AwardIsDeservedWorstValue(int32_t activeAwardTypes, [[maybe_unused]] const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestValue))
         return false;
@@ -240,36 +168,17 @@ static bool AwardIsDeservedWorstValue(int32_t activeAwardTypes)
 }
 
 /** No more than 2 people who think the vandalism is bad and no crashes. */
-static bool AwardIsDeservedSafest([[maybe_unused]] int32_t activeAwardTypes)
+static bool AwardIsDeservedSafest([[maybe_unused]] int32_t activeAwardTypes, const ParkStatistics& stats)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
-
-    if (peepsWhoDislikeVandalism > 2)
+    if (stats.GetFreshThoughtCount(PeepThoughtType::Vandalism) > 2)
         return false;
 
     // Check for rides that have crashed maybe?
-    const auto& rideManager = GetRideManager();
-    if (std::any_of(rideManager.begin(), rideManager.end(), [](const Ride& ride) {
-            return ride.last_crash_type != RIDE_CRASH_TYPE_NONE;
-        }))
-    {
-        return false;
-    }
-
-    return true;
+    return !stats.AnyRideCrashed;
 }
 
 /** All staff types, at least 20 staff, one staff per 32 peeps. */
-static bool AwardIsDeservedBestStaff(int32_t activeAwardTypes)
+static bool AwardIsDeservedBestStaff(int32_t activeAwardTypes, [[maybe_unused]] const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
@@ -281,314 +190,133 @@ static bool AwardIsDeservedBestStaff(int32_t activeAwardTypes)
 }
 
 /** At least 7 shops, 4 unique, one shop per 128 guests and no more than 12 hungry guests. */
-static bool AwardIsDeservedBestFood(int32_t activeAwardTypes)
+static bool AwardIsDeservedBestFood(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::WorstFood))
         return false;
 
-    uint32_t shops = 0;
-    uint32_t uniqueShops = 0;
-    uint64_t shopTypes = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        auto rideEntry = GetRideEntryByIndex(ride.subtype);
-        if (rideEntry != nullptr)
-        {
-            if (!(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
-            {
-                shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
-                uniqueShops++;
-            }
-        }
-    }
-
-    if (shops < 7 || uniqueShops < 4 || shops < gNumGuestsInPark / 128)
+    if (stats.FoodShops < 7 || stats.UniqueFoodShops < 4 || stats.FoodShops < gNumGuestsInPark / 128)
         return false;
 
-    // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
-    return (hungryPeeps <= 12);
+    return (stats.GetFreshThoughtCount(PeepThoughtType::Hungry) <= 12);
 }
 
 /** No more than 2 unique shops, less than one shop per 256 guests and more than 15 hungry guests. */
-static bool AwardIsDeservedWorstFood(int32_t activeAwardTypes)
+static bool AwardIsDeservedWorstFood(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestFood))
         return false;
 
-    uint32_t shops = 0;
-    uint32_t uniqueShops = 0;
-    uint64_t shopTypes = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry != nullptr)
-        {
-            if (!(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
-            {
-                shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
-                uniqueShops++;
-            }
-        }
-    }
-
-    if (uniqueShops > 2 || shops > gNumGuestsInPark / 256)
+    if (stats.UniqueFoodShops > 2 || stats.FoodShops > gNumGuestsInPark / 256)
         return false;
 
-    // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
-    return (hungryPeeps > 15);
+    return (stats.GetFreshThoughtCount(PeepThoughtType::Hungry) > 15);
 }
 
 /** At least 4 toilets, 1 toilet per 128 guests and no more than 16 guests who think they need the toilet. */
-static bool AwardIsDeservedBestToilets([[maybe_unused]] int32_t activeAwardTypes)
+static bool AwardIsDeservedBestToilets([[maybe_unused]] int32_t activeAwardTypes, const ParkStatistics& stats)
 {
-    // Count open toilets
-    const auto& rideManager = GetRideManager();
-    auto numToilets = static_cast<size_t>(std::count_if(rideManager.begin(), rideManager.end(), [](const Ride& ride) {
-        const auto& rtd = ride.GetRideTypeDescriptor();
-        return rtd.HasFlag(RIDE_TYPE_FLAG_IS_TOILET) && ride.status == RideStatus::Open;
-    }));
-
     // At least 4 open toilets
-    if (numToilets < 4)
+    if (stats.Toilets < 4)
         return false;
 
     // At least one open toilet for every 128 guests
-    if (numToilets < gNumGuestsInPark / 128u)
+    if (stats.Toilets < gNumGuestsInPark / 128u)
         return false;
 
     // Count number of guests who are thinking they need the toilet
-    auto guestsWhoNeedToilet = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedToilet++;
-    }
-    return (guestsWhoNeedToilet <= 16);
+    return (stats.GetFreshThoughtCount(PeepThoughtType::Toilet) <= 16);
 }
 
 /** More than half of the rides have satisfaction <= 6 and park rating <= 650. */
-static bool AwardIsDeservedMostDisappointing(int32_t activeAwardTypes)
+static bool AwardIsDeservedMostDisappointing(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestValue))
         return false;
     if (gParkRating > 650)
         return false;
 
-    // Count the number of disappointing rides
-    auto countedRides = 0;
-    auto disappointingRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (RideHasRatings(ride) && ride.popularity != 0xFF)
-        {
-            countedRides++;
-            if (ride.popularity <= 6)
-            {
-                disappointingRides++;
-            }
-        }
-    }
-
     // Half of the rides are disappointing
-    return (disappointingRides >= countedRides / 2);
+    return (stats.DisappointingRides >= stats.RidesWithPopularity / 2);
 }
 
 /** At least 6 open water rides. */
-static bool AwardIsDeservedBestWaterRides([[maybe_unused]] int32_t activeAwardTypes)
+static bool AwardIsDeservedBestWaterRides([[maybe_unused]] int32_t activeAwardTypes, const ParkStatistics& stats)
 {
-    auto waterRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_WATER))
-        {
-            continue;
-        }
-
-        waterRides++;
-    }
-
-    return (waterRides >= 6);
+    return (stats.WaterRides >= 6);
 }
 
 /** At least 6 custom designed rides. */
-static bool AwardIsDeservedBestCustomDesignedRides(int32_t activeAwardTypes)
+static bool AwardIsDeservedBestCustomDesignedRides(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    auto customDesignedRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_NOT_CUSTOM_DESIGN)
-            continue;
-        if (ride.excitement < RIDE_RATING(5, 50))
-            continue;
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-            continue;
-
-        customDesignedRides++;
-    }
-
-    return (customDesignedRides >= 6);
+    return (stats.CustomDesignedRides >= 6);
 }
 
-static bool AwardIsDeservedMostDazzlingRideColours(int32_t activeAwardTypes)
+/** At least 5 colourful rides and more than half of the rides are colourful. */
+static bool AwardIsDeservedMostDazzlingRideColours(int32_t activeAwardTypes, const ParkStatistics& stats)
 {
-    /** At least 5 colourful rides and more than half of the rides are colourful. */
-    static constexpr colour_t dazzling_ride_colours[] = {
-        COLOUR_BRIGHT_PURPLE,
-        COLOUR_BRIGHT_GREEN,
-        COLOUR_LIGHT_ORANGE,
-        COLOUR_BRIGHT_PINK,
-    };
-
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    auto countedRides = 0;
-    auto colourfulRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
-            continue;
-
-        countedRides++;
-
-        auto mainTrackColour = ride.track_colour[0].main;
-        for (auto dazzling_ride_colour : dazzling_ride_colours)
-        {
-            if (mainTrackColour == dazzling_ride_colour)
-            {
-                colourfulRides++;
-                break;
-            }
-        }
-    }
-
-    return (colourfulRides >= 5 && colourfulRides >= countedRides - colourfulRides);
+    return (stats.ColourfulRides >= 5 && stats.ColourfulRides >= stats.TrackedRides - stats.ColourfulRides);
 }
 
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
-static bool AwardIsDeservedMostConfusingLayout([[maybe_unused]] int32_t activeAwardTypes)
+static bool AwardIsDeservedMostConfusingLayout([[maybe_unused]] int32_t activeAwardTypes, const ParkStatistics& stats)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
-
-    return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
+    const auto peepsLost = stats.GetFreshThoughtCount(PeepThoughtType::Lost)
+        + stats.GetFreshThoughtCount(PeepThoughtType::CantFind);
+    return (peepsLost >= 10 && peepsLost >= stats.Guests / 64);
 }
 
 /** At least 10 open gentle rides. */
-static bool AwardIsDeservedBestGentleRides([[maybe_unused]] int32_t activeAwardTypes)
+static bool AwardIsDeservedBestGentleRides([[maybe_unused]] int32_t activeAwardTypes, const ParkStatistics& stats)
 {
-    auto gentleRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_GENTLE))
-        {
-            continue;
-        }
-
-        gentleRides++;
-    }
-
-    return (gentleRides >= 10);
+    return (stats.GentleRides >= 10);
 }
 
-using award_deserved_check = bool (*)(int32_t);
-
-static constexpr award_deserved_check _awardChecks[] = {
-    AwardIsDeservedMostUntidy,
-    AwardIsDeservedMostTidy,
-    AwardIsDeservedBestRollercoasters,
-    AwardIsDeservedBestValue,
-    AwardIsDeservedMostBeautiful,
-    AwardIsDeservedWorstValue,
-    AwardIsDeservedSafest,
-    AwardIsDeservedBestStaff,
-    AwardIsDeservedBestFood,
-    AwardIsDeservedWorstFood,
-    AwardIsDeservedBestToilets,
-    AwardIsDeservedMostDisappointing,
-    AwardIsDeservedBestWaterRides,
-    AwardIsDeservedBestCustomDesignedRides,
-    AwardIsDeservedMostDazzlingRideColours,
-    AwardIsDeservedMostConfusingLayout,
-    AwardIsDeservedBestGentleRides,
+using award_deserved_check = bool (*)(int32_t, const ParkStatistics&);
+
+namespace
+{
+    struct AwardCheck
+    {
+        award_deserved_check IsDeserved;
+        // Parts of the park statistics the check uses, only those are gathered.
+        uint64_t Statistics;
+    };
+} // namespace
+
+static constexpr uint64_t GuestStatistics = EnumToFlag(ParkStatisticsPart::Guests);
+static constexpr uint64_t RideStatistics = EnumToFlag(ParkStatisticsPart::Rides);
+
+static constexpr AwardCheck _awardChecks[] = {
+    { AwardIsDeservedMostUntidy, GuestStatistics },
+    { AwardIsDeservedMostTidy, GuestStatistics },
+    { AwardIsDeservedBestRollercoasters, RideStatistics },
+    { AwardIsDeservedBestValue, 0 },
+    { AwardIsDeservedMostBeautiful, GuestStatistics },
+    { AwardIsDeservedWorstValue, 0 },
+    { AwardIsDeservedSafest, GuestStatistics | RideStatistics },
+    { AwardIsDeservedBestStaff, 0 },
+    { AwardIsDeservedBestFood, GuestStatistics | RideStatistics },
+    { AwardIsDeservedWorstFood, GuestStatistics | RideStatistics },
+    { AwardIsDeservedBestToilets, GuestStatistics | RideStatistics },
+    { AwardIsDeservedMostDisappointing, RideStatistics },
+    { AwardIsDeservedBestWaterRides, RideStatistics },
+    { AwardIsDeservedBestCustomDesignedRides, RideStatistics },
+    { AwardIsDeservedMostDazzlingRideColours, RideStatistics },
+    { AwardIsDeservedMostConfusingLayout, GuestStatistics },
+    { AwardIsDeservedBestGentleRides, RideStatistics },
 };
 
 static bool AwardIsDeserved(AwardType awardType, int32_t activeAwardTypes)
 {
-    return _awardChecks[EnumValue(awardType)](activeAwardTypes);
+    const auto& check = _awardChecks[EnumValue(awardType)];
+    return check.IsDeserved(activeAwardTypes, GatherParkStatistics(check.Statistics));
 }
 
 #pragma endregion
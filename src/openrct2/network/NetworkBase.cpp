@@ -36,6 +36,7 @@
 #include "network.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <stdexcept>
 
@@ -43,7 +44,7 @@
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-#define NETWORK_STREAM_VERSION "0"
+#define NETWORK_STREAM_VERSION "1"
 
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
@@ -52,10 +53,6 @@ static int32_t _pickup_peep_old_x = LOCATION_NULL;
 
 #ifndef DISABLE_NETWORK
 
-// General chunk size is 63 KiB, this can not be any larger because the packet size is encoded
-// with uint16_t and needs some spare room for other data in the packet.
-static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
-
 // If data is sent fast enough it would halt the entire server, process only a maximum amount.
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t MaxPacketsPerUpdate = 100;
@@ -68,6 +65,7 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 #    include "../core/Console.hpp"
 #    include "../core/FileStream.h"
 #    include "../core/MemoryStream.h"
+#    include "../core/OrcaStream.hpp"
 #    include "../core/Path.hpp"
 #    include "../core/String.hpp"
 #    include "../interface/Chat.h"
@@ -197,6 +195,7 @@ void NetworkBase::Close()
         CloseConnection();
 
         client_connection_list.clear();
+        _savedMap = {};
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
         player_list.clear();
@@ -534,6 +533,13 @@ void NetworkBase::UpdateServer()
         ServerSendPingList();
     }
 
+    // The saved map is only shared by clients that join in the same tick, the connections keep their own reference.
+    if (_savedMap.valid() && _savedMapTick != gCurrentTicks
+        && _savedMap.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        _savedMap = {};
+    }
+
     if (_advertiser != nullptr)
     {
         _advertiser->Update();
@@ -1364,7 +1370,9 @@ NetworkStats NetworkBase::GetStats() const
                 stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
                 stats.bytesSent[n] += connection->Stats.bytesSent[n];
             }
+            stats.mapTransferTime = std::max(stats.mapTransferTime, connection->Stats.mapTransferTime);
         }
+        stats.mapSaveTime = _mapSaveTime;
     }
     return stats;
 }
@@ -1405,8 +1413,8 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
-    auto header = SaveForNetwork(objects);
-    if (header.empty())
+    auto map = SaveForNetwork(objects);
+    if (map.wait_for(std::chrono::seconds(0)) == std::future_status::ready && map.get().empty())
     {
         if (connection != nullptr)
         {
@@ -1415,38 +1423,67 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         }
         return;
     }
-    size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < header.size(); i += chunksize)
+
+    // The map is compressed in the background, the connections send it once it is ready.
+    if (connection != nullptr)
     {
-        size_t datasize = std::min(chunksize, header.size() - i);
-        NetworkPacket packet(NetworkCommand::Map);
-        packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
-        packet.Write(&header[i], datasize);
-        if (connection != nullptr)
-        {
-            connection->QueuePacket(std::move(packet));
-        }
-        else
+        connection->QueueMap(map);
+    }
+    else
+    {
+        for (auto& clientConnection : client_connection_list)
         {
-            SendPacketToClients(packet);
+            if (clientConnection->AuthStatus == NetworkAuth::Ok)
+            {
+                clientConnection->QueueMap(map);
+            }
         }
     }
 }
 
-std::vector<uint8_t> NetworkBase::SaveForNetwork(const std::vector<const ObjectRepositoryItem*>& objects) const
+std::shared_future<std::vector<uint8_t>> NetworkBase::SaveForNetwork(
+    const std::vector<const ObjectRepositoryItem*>& objects)
 {
-    std::vector<uint8_t> result;
-    auto ms = OpenRCT2::MemoryStream();
-    if (SaveMap(&ms, objects))
+    // Clients that join in the same tick and need the same objects share the map.
+    if (_savedMap.valid() && _savedMapTick == gCurrentTicks && _savedMapObjects == objects)
     {
-        result.resize(ms.GetLength());
-        std::memcpy(result.data(), ms.GetData(), result.size());
+        return _savedMap;
     }
-    else
+
+    // Only serialising needs the game state, the compression is done on another thread.
+    const auto startTime = Platform::GetTicks();
+    auto ms = std::make_unique<OpenRCT2::MemoryStream>();
+    if (!SaveMap(ms.get(), objects, false))
     {
         LOG_WARNING("Failed to export map.");
+
+        std::promise<std::vector<uint8_t>> failed;
+        failed.set_value({});
+        return failed.get_future().share();
     }
-    return result;
+    _mapSaveTime = Platform::GetTicks() - startTime;
+
+    auto compressTask = std::async(std::launch::async, [ms = std::move(ms)]() {
+        std::vector<uint8_t> result;
+        try
+        {
+            OpenRCT2::MemoryStream compressed;
+            ms->SetPosition(0);
+            OrcaStream::Compress(*ms, compressed, OrcaStream::COMPRESSION_GZIP_CHUNKS);
+
+            const auto* data = static_cast<const uint8_t*>(compressed.GetData());
+            result.assign(data, data + compressed.GetLength());
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Unable to compress map: %s", e.what());
+        }
+        return result;
+    });
+    _savedMap = compressTask.share();
+    _savedMapTick = gCurrentTicks;
+    _savedMapObjects = objects;
+    return _savedMap;
 }
 
 void NetworkBase::Client_Send_CHAT(const char* text)
@@ -2696,7 +2733,7 @@ void NetworkBase::ServerHandleAuth(NetworkConnection& connection, NetworkPacket&
     }
 }
 
-void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+void NetworkBase::Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t size, offset;
     packet >> size >> offset;
@@ -2714,6 +2751,7 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
 
         _serverTickData.clear();
         _clientMapLoaded = false;
+        _mapTransferStartTime = Platform::GetTicks();
     }
     if (size > chunk_buffer.size())
     {
@@ -2734,6 +2772,8 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
     std::memcpy(&chunk_buffer[offset], const_cast<void*>(static_cast<const void*>(packet.Read(chunksize))), chunksize);
     if (offset + chunksize == size)
     {
+        connection.Stats.mapTransferTime = Platform::GetTicks() - _mapTransferStartTime;
+
         // Allow queue processing of game actions again.
         GameActions::ResumeQueue();
 
@@ -2805,7 +2845,8 @@ bool NetworkBase::LoadMap(IStream* stream)
     return result;
 }
 
-bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const
+bool NetworkBase::SaveMap(
+    IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects, bool compress) const
 {
     bool result = false;
     PrepareMapForSave();
@@ -2813,6 +2854,7 @@ bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectReposit
     {
         auto exporter = std::make_unique<ParkFileExporter>();
         exporter->ExportObjectsList = objects;
+        exporter->Compress = compress;
         exporter->Export(*stream);
         result = true;
     }
@@ -11,6 +11,7 @@
 #include "NetworkUser.h"
 
 #include <fstream>
+#include <future>
 #include <memory>
 
 #ifndef DISABLE_NETWORK
@@ -78,8 +79,9 @@ public: // Server
     void RemovePlayer(std::unique_ptr<NetworkConnection>& connection);
     void UpdateServer();
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
-    bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
-    std::vector<uint8_t> SaveForNetwork(const std::vector<const ObjectRepositoryItem*>& objects) const;
+    bool SaveMap(
+        OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects, bool compress = true) const;
+    std::shared_future<std::vector<uint8_t>> SaveForNetwork(const std::vector<const ObjectRepositoryItem*>& objects);
     std::string MakePlayerNameUnique(const std::string& name);
 
     // Packet dispatchers.
@@ -204,6 +206,11 @@ private: // Server Data
     std::ofstream _server_log_fs;
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
+    // The last map that was saved for joining clients.
+    std::shared_future<std::vector<uint8_t>> _savedMap;
+    std::vector<const ObjectRepositoryItem*> _savedMapObjects;
+    uint32_t _savedMapTick = 0;
+    uint32_t _mapSaveTime = 0;
 
 private: // Client Data
     struct PlayerListUpdate
@@ -240,6 +247,7 @@ private: // Client Data
     uint32_t _lastSentHeartbeat = 0;
     uint32_t last_ping_sent_time = 0;
     uint32_t server_connect_time = 0;
+    uint32_t _mapTransferStartTime = 0;
     uint32_t _actionId;
     int32_t status = NETWORK_STATUS_NONE;
     uint8_t player_id = 0;
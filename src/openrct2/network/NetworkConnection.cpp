@@ -18,6 +18,10 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <chrono>
+#    include <iterator>
+#    include <utility>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
 
@@ -81,7 +85,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             InboundPacket.Write(buffer, bytesRead);
         }
 
-        if (InboundPacket.Data.size() == header.Size)
+        if (InboundPacket.GetSize() == header.Size)
         {
             // Received complete packet.
             _lastPacketTime = Platform::GetTicks();
@@ -99,26 +103,35 @@ bool NetworkConnection::SendPacket(NetworkPacket& packet)
 {
     auto header = packet.Header;
 
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
     header.Size += sizeof(header.Id);
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
+    // The header and the shared packet data are sent without copying them into one buffer.
+    const auto* data = std::as_const(packet).GetData();
+    const size_t totalSize = sizeof(header) + packet.GetSize();
+    size_t sent;
+    if (packet.BytesTransferred < sizeof(header))
+    {
+        const SocketBuffer buffers[] = {
+            { reinterpret_cast<const uint8_t*>(&header) + packet.BytesTransferred, sizeof(header) - packet.BytesTransferred },
+            { data, packet.GetSize() },
+        };
+        sent = Socket->SendData(buffers, std::size(buffers));
+    }
+    else
+    {
+        const size_t offset = packet.BytesTransferred - sizeof(header);
+        sent = Socket->SendData(data + offset, packet.GetSize() - offset);
+    }
     if (sent > 0)
     {
         packet.BytesTransferred += sent;
     }
 
-    bool sendComplete = packet.BytesTransferred == buffer.size();
+    bool sendComplete = packet.BytesTransferred == totalSize;
     if (sendComplete)
     {
         RecordPacketStats(packet, true);
@@ -130,9 +143,14 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        packet.Header.Size = static_cast<uint16_t>(packet.GetSize());
         if (front)
         {
+            if (_map.valid())
+            {
+                _packetsBeforeMap++;
+            }
+
             // If the first packet was already partially sent add new packet to second position
             if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
             {
@@ -152,6 +170,53 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
     }
 }
 
+void NetworkConnection::QueueMap(std::shared_future<std::vector<uint8_t>> map)
+{
+    // A map that is still being sent is replaced, clients start over when they receive the first chunk.
+    if (!_map.valid())
+    {
+        _packetsBeforeMap = _outboundPackets.size();
+    }
+    _map = std::move(map);
+    _mapOffset = 0;
+    _mapQueueTime = Platform::GetTicks();
+}
+
+bool NetworkConnection::QueueMapChunk()
+{
+    if (_map.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return false;
+    }
+
+    const auto& map = _map.get();
+    if (map.empty())
+    {
+        _map = {};
+        SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+        Disconnect();
+        return false;
+    }
+
+    const auto chunkSize = std::min<size_t>(CHUNK_SIZE, map.size() - _mapOffset);
+    NetworkPacket packet(NetworkCommand::Map);
+    packet << static_cast<uint32_t>(map.size()) << static_cast<uint32_t>(_mapOffset);
+    packet.Write(&map[_mapOffset], chunkSize);
+    packet.Header.Size = static_cast<uint16_t>(packet.GetSize());
+    _mapOffset += chunkSize;
+
+    // Packets behind the map have not been started yet, the chunk goes in front of them.
+    _outboundPackets.push_front(std::move(packet));
+    _packetsBeforeMap = 1;
+
+    if (_mapOffset == map.size())
+    {
+        Stats.mapTransferTime = Platform::GetTicks() - _mapQueueTime;
+        _map = {};
+    }
+    return true;
+}
+
 void NetworkConnection::Disconnect() noexcept
 {
     ShouldDisconnect = true;
@@ -164,12 +229,29 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    while (true)
     {
+        if (_map.valid() && _packetsBeforeMap == 0 && !QueueMapChunk())
+        {
+            break;
+        }
+        if (_outboundPackets.empty() || !SendPacket(_outboundPackets.front()))
+        {
+            break;
+        }
         _outboundPackets.pop_front();
+        if (_packetsBeforeMap > 0)
+        {
+            _packetsBeforeMap--;
+        }
     }
 }
 
+size_t NetworkConnection::GetOutboundQueueSize() const noexcept
+{
+    return _outboundPackets.size();
+}
+
 void NetworkConnection::ResetLastPacketTime() noexcept
 {
     _lastPacketTime = Platform::GetTicks();
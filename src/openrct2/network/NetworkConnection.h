@@ -17,6 +17,7 @@
 #    include "Socket.h"
 
 #    include <deque>
+#    include <future>
 #    include <memory>
 #    include <string_view>
 #    include <vector>
@@ -24,6 +25,10 @@
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
+// General chunk size is 63 KiB, this can not be any larger because the packet size is encoded
+// with uint16_t and needs some spare room for other data in the packet.
+static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
+
 class NetworkConnection final
 {
 public:
@@ -48,12 +53,21 @@ public:
         return QueuePacket(std::move(copy), front);
     }
 
+    /**
+     * Sends the map in chunks of CHUNK_SIZE once it is ready, one chunk is queued at a time so that the
+     * data is shared with other connections. Packets queued afterwards are held back until the whole map
+     * was sent, an empty map disconnects the client.
+     */
+    void QueueMap(std::shared_future<std::vector<uint8_t>> map);
+
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
     void Disconnect() noexcept;
 
     bool IsValid() const;
     void SendQueuedPackets();
+    // Number of packets waiting to be sent, including the ones held back by the map.
+    size_t GetOutboundQueueSize() const noexcept;
     void ResetLastPacketTime() noexcept;
     bool ReceivedPacketRecently() const noexcept;
 
@@ -66,8 +80,15 @@ private:
     uint32_t _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
+    std::shared_future<std::vector<uint8_t>> _map;
+    size_t _mapOffset = 0;
+    uint32_t _mapQueueTime = 0;
+    // Number of outbound packets that have to be sent before the next chunk of the map.
+    size_t _packetsBeforeMap = 0;
+
     void RecordPacketStats(const NetworkPacket& packet, bool sending);
     bool SendPacket(NetworkPacket& packet);
+    bool QueueMapChunk();
 };
 
 #endif // DISABLE_NETWORK
@@ -14,20 +14,142 @@
 #    include "NetworkTypes.h"
 
 #    include <memory>
+#    include <mutex>
+
+namespace
+{
+    using PacketBuffer = std::shared_ptr<std::vector<uint8_t>>;
+
+    // Larger buffers are released, map chunks are the largest packets sent regularly.
+    constexpr size_t MaxPooledBufferCapacity = 64 * 1024;
+    constexpr size_t MaxPooledBuffers = 512;
+
+    struct PacketBufferPool
+    {
+        std::mutex Mutex;
+        std::vector<PacketBuffer> Buffers;
+        size_t AllocatedCount{};
+    };
+
+    // Never destroyed, packets may be released by other static objects on exit.
+    PacketBufferPool& GetPacketBufferPool()
+    {
+        static auto* pool = new PacketBufferPool();
+        return *pool;
+    }
+
+    PacketBuffer AcquirePacketBuffer()
+    {
+        auto& pool = GetPacketBufferPool();
+        {
+            std::lock_guard<std::mutex> lock(pool.Mutex);
+            if (!pool.Buffers.empty())
+            {
+                auto buffer = std::move(pool.Buffers.back());
+                pool.Buffers.pop_back();
+                return buffer;
+            }
+            pool.AllocatedCount++;
+        }
+        return std::make_shared<std::vector<uint8_t>>();
+    }
+
+    void ReleasePacketBuffer(PacketBuffer&& buffer)
+    {
+        buffer->clear();
+        if (buffer->capacity() > MaxPooledBufferCapacity)
+            return;
+
+        auto& pool = GetPacketBufferPool();
+        std::lock_guard<std::mutex> lock(pool.Mutex);
+        if (pool.Buffers.size() < MaxPooledBuffers)
+        {
+            pool.Buffers.push_back(std::move(buffer));
+        }
+    }
+} // namespace
 
 NetworkPacket::NetworkPacket(NetworkCommand id) noexcept
     : Header{ 0, id }
 {
 }
 
-uint8_t* NetworkPacket::GetData() noexcept
+NetworkPacket::~NetworkPacket()
+{
+    ReleaseData();
+}
+
+NetworkPacket& NetworkPacket::operator=(const NetworkPacket& other)
+{
+    if (this != &other)
+    {
+        ReleaseData();
+        Header = other.Header;
+        BytesTransferred = other.BytesTransferred;
+        BytesRead = other.BytesRead;
+        _data = other._data;
+    }
+    return *this;
+}
+
+NetworkPacket& NetworkPacket::operator=(NetworkPacket&& other) noexcept
 {
-    return Data.data();
+    if (this != &other)
+    {
+        ReleaseData();
+        Header = other.Header;
+        BytesTransferred = other.BytesTransferred;
+        BytesRead = other.BytesRead;
+        _data = std::move(other._data);
+    }
+    return *this;
+}
+
+size_t NetworkPacket::GetAllocatedBufferCount()
+{
+    auto& pool = GetPacketBufferPool();
+    std::lock_guard<std::mutex> lock(pool.Mutex);
+    return pool.AllocatedCount;
+}
+
+std::vector<uint8_t>& NetworkPacket::GetWritableData()
+{
+    if (_data == nullptr)
+    {
+        _data = AcquirePacketBuffer();
+    }
+    else if (_data.use_count() > 1)
+    {
+        // Copy on write, the other packets keep the current data.
+        auto copy = AcquirePacketBuffer();
+        copy->assign(_data->begin(), _data->end());
+        _data = std::move(copy);
+    }
+    return *_data;
+}
+
+void NetworkPacket::ReleaseData() noexcept
+{
+    if (_data != nullptr && _data.use_count() == 1)
+    {
+        ReleasePacketBuffer(std::move(_data));
+    }
+    _data = nullptr;
+}
+
+uint8_t* NetworkPacket::GetData()
+{
+    return _data != nullptr ? GetWritableData().data() : nullptr;
 }
 
 const uint8_t* NetworkPacket::GetData() const noexcept
 {
-    return Data.data();
+    return _data != nullptr ? _data->data() : nullptr;
+}
+
+size_t NetworkPacket::GetSize() const noexcept
+{
+    return _data != nullptr ? _data->size() : 0;
 }
 
 NetworkCommand NetworkPacket::GetCommand() const noexcept
@@ -39,7 +161,14 @@ void NetworkPacket::Clear() noexcept
 {
     BytesTransferred = 0;
     BytesRead = 0;
-    Data.clear();
+    if (_data != nullptr && _data.use_count() == 1)
+    {
+        _data->clear();
+    }
+    else
+    {
+        ReleaseData();
+    }
 }
 
 bool NetworkPacket::CommandRequiresAuth() const noexcept
@@ -64,36 +193,37 @@ bool NetworkPacket::CommandRequiresAuth() const noexcept
 void NetworkPacket::Write(const void* bytes, size_t size)
 {
     const uint8_t* src = reinterpret_cast<const uint8_t*>(bytes);
-    Data.insert(Data.end(), src, src + size);
+    auto& data = GetWritableData();
+    data.insert(data.end(), src, src + size);
 }
 
 void NetworkPacket::WriteString(std::string_view s)
 {
     Write(s.data(), s.size());
-    Data.push_back(0);
+    GetWritableData().push_back(0);
 }
 
 const uint8_t* NetworkPacket::Read(size_t size)
 {
-    if (BytesRead + size > Data.size())
+    if (BytesRead + size > GetSize())
     {
         return nullptr;
     }
 
-    const uint8_t* data = Data.data() + BytesRead;
+    const uint8_t* data = std::as_const(*this).GetData() + BytesRead;
     BytesRead += size;
     return data;
 }
 
 std::string_view NetworkPacket::ReadString()
 {
-    if (BytesRead >= Data.size())
+    if (BytesRead >= GetSize())
         return {};
 
-    const char* str = reinterpret_cast<const char*>(Data.data() + BytesRead);
+    const char* str = reinterpret_cast<const char*>(std::as_const(*this).GetData() + BytesRead);
 
     size_t stringLen = 0;
-    while (BytesRead < Data.size() && str[stringLen] != '\0')
+    while (BytesRead < GetSize() && str[stringLen] != '\0')
     {
         BytesRead++;
         stringLen++;
@@ -14,6 +14,7 @@
 #include "NetworkTypes.h"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #pragma pack(push, 1)
@@ -25,13 +26,24 @@ struct PacketHeader
 static_assert(sizeof(PacketHeader) == 6);
 #pragma pack(pop)
 
+/**
+ * Copies of a packet share its data until one of them is written to, so a packet that is sent to many
+ * connections is only encoded once. Buffers of released packets are kept in a pool for new packets.
+ */
 struct NetworkPacket final
 {
     NetworkPacket() noexcept = default;
     NetworkPacket(NetworkCommand id) noexcept;
+    NetworkPacket(const NetworkPacket& other) = default;
+    NetworkPacket(NetworkPacket&& other) noexcept = default;
+    ~NetworkPacket();
 
-    uint8_t* GetData() noexcept;
+    NetworkPacket& operator=(const NetworkPacket& other);
+    NetworkPacket& operator=(NetworkPacket&& other) noexcept;
+
+    uint8_t* GetData();
     const uint8_t* GetData() const noexcept;
+    size_t GetSize() const noexcept;
 
     NetworkCommand GetCommand() const noexcept;
 
@@ -53,7 +65,7 @@ struct NetworkPacket final
         else
         {
             T local;
-            std::memcpy(&local, &GetData()[BytesRead], sizeof(local));
+            std::memcpy(&local, &std::as_const(*this).GetData()[BytesRead], sizeof(local));
             value = ByteSwapBE(local);
             BytesRead += sizeof(value);
         }
@@ -73,9 +85,19 @@ struct NetworkPacket final
         return *this;
     }
 
+    /**
+     * Returns the number of buffers that had to be allocated because the pool was empty.
+     */
+    static size_t GetAllocatedBufferCount();
+
 public:
     PacketHeader Header{};
-    std::vector<uint8_t> Data;
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
+
+private:
+    std::shared_ptr<std::vector<uint8_t>> _data;
+
+    std::vector<uint8_t>& GetWritableData();
+    void ReleaseData() noexcept;
 };
@@ -0,0 +1,290 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkSimulatedClient.h"
+
+#    include "../actions/GameAction.h"
+#    include "../core/DataSerialiser.h"
+#    include "../platform/Platform.h"
+#    include "Socket.h"
+#    include "network.h"
+
+#    include <utility>
+
+NetworkSimulatedClient::NetworkSimulatedClient(std::string name, const NetworkKey& key, std::string publicKey)
+    : _name(std::move(name))
+    , _key(key)
+    , _publicKey(std::move(publicKey))
+{
+}
+
+void NetworkSimulatedClient::Connect(const std::string& host, uint16_t port)
+{
+    _connection.Socket = CreateTcpSocket();
+    _connection.Socket->ConnectAsync(host, port);
+    _connectTime = Platform::GetTicks();
+    _state = State::Connecting;
+}
+
+void NetworkSimulatedClient::Disconnect()
+{
+    if (_state != State::Disconnected)
+    {
+        _connection.Socket->Disconnect();
+        SetDisconnected("Disconnected by client");
+    }
+}
+
+void NetworkSimulatedClient::Update()
+{
+    if (_state == State::Disconnected)
+    {
+        return;
+    }
+
+    if (_state == State::Connecting)
+    {
+        switch (_connection.Socket->GetStatus())
+        {
+            case SocketStatus::Resolving:
+            case SocketStatus::Connecting:
+                return;
+            case SocketStatus::Connected:
+                _state = State::Authenticating;
+                _connection.ResetLastPacketTime();
+                _connection.QueuePacket(NetworkPacket(NetworkCommand::Token));
+                break;
+            default:
+            {
+                const char* error = _connection.Socket->GetError();
+                SetDisconnected(error != nullptr ? error : "Unable to connect");
+                return;
+            }
+        }
+    }
+
+    NetworkReadPacket status;
+    do
+    {
+        status = _connection.ReadPacket();
+        if (status == NetworkReadPacket::Success)
+        {
+            ProcessPacket(_connection.InboundPacket);
+            _connection.InboundPacket.Clear();
+        }
+        else if (status == NetworkReadPacket::Disconnected)
+        {
+            SetDisconnected("Connection closed by server");
+            return;
+        }
+    } while (status == NetworkReadPacket::Success && _state != State::Disconnected);
+
+    // Same interval as the regular client, the server drops connections it did not hear from in a while.
+    const auto ticks = Platform::GetTicks();
+    if (ticks - _lastHeartbeatTime >= 3000)
+    {
+        _connection.QueuePacket(NetworkPacket(NetworkCommand::Heartbeat));
+        _lastHeartbeatTime = ticks;
+    }
+
+    _connection.SendQueuedPackets();
+    if (!_connection.IsValid() && _state != State::Disconnected)
+    {
+        SetDisconnected("Connection lost");
+    }
+}
+
+void NetworkSimulatedClient::SendGameAction(uint32_t tick, const GameAction& action)
+{
+    DataSerialiser stream(true);
+    action.Serialise(stream);
+
+    NetworkPacket packet(NetworkCommand::GameAction);
+    packet << tick << action.GetType() << stream;
+    _connection.QueuePacket(std::move(packet));
+}
+
+NetworkSimulatedClient::State NetworkSimulatedClient::GetState() const noexcept
+{
+    return _state;
+}
+
+const std::string& NetworkSimulatedClient::GetName() const noexcept
+{
+    return _name;
+}
+
+uint8_t NetworkSimulatedClient::GetPlayerId() const noexcept
+{
+    return _playerId;
+}
+
+const NetworkStats& NetworkSimulatedClient::GetStats() const noexcept
+{
+    return _connection.Stats;
+}
+
+size_t NetworkSimulatedClient::GetOutboundQueueSize() const noexcept
+{
+    return _connection.GetOutboundQueueSize();
+}
+
+const std::string& NetworkSimulatedClient::GetDisconnectReason() const noexcept
+{
+    return _disconnectReason;
+}
+
+uint32_t NetworkSimulatedClient::GetJoinTime() const noexcept
+{
+    return _joinTime;
+}
+
+uint32_t NetworkSimulatedClient::GetMapSize() const noexcept
+{
+    return _mapSize;
+}
+
+uint32_t NetworkSimulatedClient::GetServerTick() const noexcept
+{
+    return _serverTick;
+}
+
+uint32_t NetworkSimulatedClient::GetGameActionsReceived() const noexcept
+{
+    return _gameActionsReceived;
+}
+
+uint32_t NetworkSimulatedClient::GetErrorsReceived() const noexcept
+{
+    return _errorsReceived;
+}
+
+void NetworkSimulatedClient::SetDisconnected(std::string_view reason)
+{
+    if (_disconnectReason.empty())
+    {
+        _disconnectReason = reason;
+    }
+    _state = State::Disconnected;
+}
+
+void NetworkSimulatedClient::ProcessPacket(NetworkPacket& packet)
+{
+    switch (packet.GetCommand())
+    {
+        case NetworkCommand::Token:
+            HandleToken(packet);
+            break;
+        case NetworkCommand::Auth:
+            HandleAuth(packet);
+            break;
+        case NetworkCommand::ObjectsList:
+            HandleObjectsList(packet);
+            break;
+        case NetworkCommand::Map:
+            HandleMap(packet);
+            break;
+        case NetworkCommand::Tick:
+            HandleTick(packet);
+            break;
+        case NetworkCommand::GameAction:
+            _gameActionsReceived++;
+            break;
+        case NetworkCommand::ShowError:
+            _errorsReceived++;
+            break;
+        case NetworkCommand::Ping:
+            _connection.QueuePacket(NetworkPacket(NetworkCommand::Ping));
+            break;
+        case NetworkCommand::DisconnectMessage:
+            SetDisconnected(packet.ReadString());
+            break;
+        default:
+            break;
+    }
+}
+
+void NetworkSimulatedClient::HandleToken(NetworkPacket& packet)
+{
+    uint32_t challengeSize{};
+    packet >> challengeSize;
+    const auto* challenge = packet.Read(challengeSize);
+    if (challenge == nullptr)
+    {
+        SetDisconnected("Received invalid token");
+        return;
+    }
+
+    std::vector<uint8_t> signature;
+    if (!_key.Sign(challenge, challengeSize, signature))
+    {
+        SetDisconnected("Failed to sign the challenge of the server");
+        return;
+    }
+
+    NetworkPacket auth(NetworkCommand::Auth);
+    auth.WriteString(NetworkGetVersion());
+    auth.WriteString(_name);
+    auth.WriteString("");
+    auth.WriteString(_publicKey);
+    auth << static_cast<uint32_t>(signature.size());
+    auth.Write(signature.data(), signature.size());
+    _connection.QueuePacket(std::move(auth));
+}
+
+void NetworkSimulatedClient::HandleAuth(NetworkPacket& packet)
+{
+    uint32_t authStatus{};
+    packet >> authStatus >> _playerId;
+    _connection.AuthStatus = static_cast<NetworkAuth>(authStatus);
+    if (_connection.AuthStatus != NetworkAuth::Ok)
+    {
+        SetDisconnected("Authentication failed with status " + std::to_string(authStatus));
+        return;
+    }
+    _state = State::DownloadingMap;
+}
+
+void NetworkSimulatedClient::HandleObjectsList(NetworkPacket& packet)
+{
+    uint32_t index{};
+    uint32_t totalObjects{};
+    packet >> index >> totalObjects;
+
+    // The objects are never loaded, so none of them are missing.
+    if (index + 1 >= totalObjects)
+    {
+        NetworkPacket request(NetworkCommand::MapRequest);
+        request << static_cast<uint32_t>(0);
+        _connection.QueuePacket(std::move(request));
+    }
+}
+
+void NetworkSimulatedClient::HandleMap(NetworkPacket& packet)
+{
+    uint32_t size{};
+    uint32_t offset{};
+    packet >> size >> offset;
+    const auto chunkSize = static_cast<uint32_t>(packet.Header.Size - packet.BytesRead);
+    _mapSize = size;
+    if (offset + chunkSize >= size)
+    {
+        _joinTime = Platform::GetTicks() - _connectTime;
+        _state = State::Joined;
+    }
+}
+
+void NetworkSimulatedClient::HandleTick(NetworkPacket& packet)
+{
+    packet >> _serverTick;
+}
+
+#endif // DISABLE_NETWORK
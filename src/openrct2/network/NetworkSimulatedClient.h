@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkConnection.h"
+
+#    include <string>
+
+class GameAction;
+
+/**
+ * A client that only speaks the multiplayer protocol, used to put load on a server. It authenticates, downloads
+ * the map, answers pings and sends game actions but has no game state of its own.
+ */
+class NetworkSimulatedClient final
+{
+public:
+    enum class State
+    {
+        Connecting,
+        Authenticating,
+        DownloadingMap,
+        Joined,
+        Disconnected,
+    };
+
+    /**
+     * The key is only used to sign the challenge of the server, it can be shared by all clients.
+     */
+    NetworkSimulatedClient(std::string name, const NetworkKey& key, std::string publicKey);
+
+    void Connect(const std::string& host, uint16_t port);
+    void Disconnect();
+
+    // Reads and handles all received packets and sends the queued ones.
+    void Update();
+    void SendGameAction(uint32_t tick, const GameAction& action);
+
+    State GetState() const noexcept;
+    const std::string& GetName() const noexcept;
+    uint8_t GetPlayerId() const noexcept;
+    const NetworkStats& GetStats() const noexcept;
+    size_t GetOutboundQueueSize() const noexcept;
+    const std::string& GetDisconnectReason() const noexcept;
+
+    // Milliseconds from connecting to having received the whole map.
+    uint32_t GetJoinTime() const noexcept;
+    uint32_t GetMapSize() const noexcept;
+    uint32_t GetServerTick() const noexcept;
+    uint32_t GetGameActionsReceived() const noexcept;
+    uint32_t GetErrorsReceived() const noexcept;
+
+private:
+    std::string _name;
+    const NetworkKey& _key;
+    std::string _publicKey;
+    NetworkConnection _connection;
+    State _state = State::Disconnected;
+    std::string _disconnectReason;
+    uint8_t _playerId{};
+    uint32_t _connectTime{};
+    uint32_t _joinTime{};
+    uint32_t _lastHeartbeatTime{};
+    uint32_t _mapSize{};
+    uint32_t _serverTick{};
+    uint32_t _gameActionsReceived{};
+    uint32_t _errorsReceived{};
+
+    void SetDisconnected(std::string_view reason);
+    void ProcessPacket(NetworkPacket& packet);
+    void HandleToken(NetworkPacket& packet);
+    void HandleAuth(NetworkPacket& packet);
+    void HandleObjectsList(NetworkPacket& packet);
+    void HandleMap(NetworkPacket& packet);
+    void HandleTick(NetworkPacket& packet);
+};
+
+#endif // DISABLE_NETWORK
@@ -145,4 +145,8 @@ struct NetworkStats
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    // Milliseconds the server did not update while serialising the last map for joining clients.
+    uint32_t mapSaveTime;
+    // Milliseconds from queueing the map to sending its last chunk, or to receiving it on clients.
+    uint32_t mapTransferTime;
 };
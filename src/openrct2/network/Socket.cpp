@@ -52,6 +52,7 @@
     #include <unistd.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include <unistd.h>
     #include "../common.h"
     using SOCKET = int32_t;
@@ -550,24 +551,73 @@ public:
     }
 
     size_t SendData(const void* buffer, size_t size) override
+    {
+        const SocketBuffer socketBuffer = { buffer, size };
+        return SendData(&socketBuffer, 1);
+    }
+
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
     {
         if (_status != SocketStatus::Connected)
         {
             throw std::runtime_error("Socket not connected.");
         }
 
+        constexpr size_t MaxBuffersPerCall = 16;
+
         size_t totalSent = 0;
-        do
+        size_t index = 0;
+        size_t offset = 0;
+        while (index < count)
         {
-            const char* bufferStart = static_cast<const char*>(buffer) + totalSent;
-            size_t remainingSize = size - totalSent;
-            int32_t sentBytes = send(_socket, bufferStart, static_cast<int32_t>(remainingSize), FLAG_NO_PIPE);
+#    ifdef _WIN32
+            WSABUF vectors[MaxBuffersPerCall];
+#    else
+            iovec vectors[MaxBuffersPerCall];
+#    endif
+            size_t numVectors = 0;
+            for (size_t i = index; i < count && numVectors < MaxBuffersPerCall; i++)
+            {
+                const size_t start = i == index ? offset : 0;
+                auto* data = const_cast<char*>(static_cast<const char*>(buffers[i].Data)) + start;
+#    ifdef _WIN32
+                vectors[numVectors].buf = data;
+                vectors[numVectors].len = static_cast<ULONG>(buffers[i].Size - start);
+#    else
+                vectors[numVectors].iov_base = data;
+                vectors[numVectors].iov_len = buffers[i].Size - start;
+#    endif
+                numVectors++;
+            }
+
+#    ifdef _WIN32
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, vectors, static_cast<DWORD>(numVectors), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    else
+            msghdr message{};
+            message.msg_iov = vectors;
+            message.msg_iovlen = numVectors;
+            auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
             if (sentBytes == SOCKET_ERROR)
             {
                 return totalSent;
             }
+#    endif
             totalSent += sentBytes;
-        } while (totalSent < size);
+
+            // Skip the buffers that were sent completely.
+            size_t remaining = static_cast<size_t>(sentBytes);
+            while (index < count && remaining >= buffers[index].Size - offset)
+            {
+                remaining -= buffers[index].Size - offset;
+                offset = 0;
+                index++;
+            }
+            offset += remaining;
+        }
         return totalSent;
     }
 
@@ -45,6 +45,15 @@ struct INetworkEndpoint
     virtual std::string GetHostname() const abstract;
 };
 
+/**
+ * Part of the data passed to ITcpSocket::SendData.
+ */
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Size;
+};
+
 /**
  * Represents a TCP socket / connection or listener.
  */
@@ -66,6 +75,8 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    // Sends the buffers in order as one block of data with a single call to the socket where possible.
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void SetNoDelay(bool noDelay) abstract;
@@ -13,6 +13,7 @@
 #include "../ParkImporter.h"
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../localisation/StringIds.h"
 #include "../ride/Ride.h"
@@ -33,7 +34,6 @@
 #include <array>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <unordered_set>
 
 /**
@@ -58,6 +58,9 @@ private:
     // Used to return a safe empty vector back from GetAllRideEntries, can be removed when std::span is available
     std::vector<ObjectEntryIndex> _nullRideTypeEntries;
 
+    // Loads the data of required objects in parallel, kept around so the threads are not created again for every load.
+    std::unique_ptr<JobPool> _loadJobs;
+
 public:
     explicit ObjectManager(IObjectRepository& objectRepository)
         : _objectRepository(objectRepository)
@@ -554,30 +557,6 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     void LoadObjects(std::vector<ObjectToLoad>& requiredObjects)
     {
         std::vector<Object*> objects;
@@ -607,7 +586,11 @@ private:
 
         // Load the objects.
         std::mutex commonMutex;
-        ParallelFor(objectsToLoad, [&](size_t i) {
+        if (_loadJobs == nullptr)
+        {
+            _loadJobs = std::make_unique<JobPool>();
+        }
+        _loadJobs->ParallelFor(objectsToLoad.size(), [&](size_t i) {
             const auto* requiredObject = objectsToLoad[i];
 
             // Object requires to be loaded, if the object successfully loads it will register it
@@ -26,6 +26,9 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
+#include <utility>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -494,6 +497,257 @@ template<int TRotation> static void PaintSessionArrangeImpl(PaintSessionCore& se
     session.PaintHead = psHead.NextQuadrantEntry;
 }
 
+namespace
+{
+    // Scratch space for the bucketed arrangement. A pass works on the nodes between the quadrant entry
+    // and the first node outside of the quadrant range, the linked list is mirrored by index so that
+    // nodes can be unlinked without a scan and compared by their position in the list.
+    struct PaintSortBuckets
+    {
+        static constexpr uint32_t End = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t OrderSpacingBits = 32;
+
+        struct Neighbour
+        {
+            PaintStructBoundBox Bounds;
+            uint16_t QuadrantIndex;
+            uint32_t Index;
+        };
+
+        struct NeighbourGroup
+        {
+            uint32_t Begin;
+            uint32_t End;
+            int64_t MinKey;
+        };
+
+        std::vector<PaintStruct*> Nodes;
+        std::vector<uint32_t> Next;
+        std::vector<uint32_t> Prev;
+        // Increasing along the list, used to tell whether a node comes after another one.
+        std::vector<uint64_t> Order;
+        // Nodes flagged as neighbour grouped by quadrant and sorted by their x position within a group.
+        std::vector<Neighbour> Neighbours;
+        std::vector<NeighbourGroup> Groups;
+        std::vector<uint32_t> Matches;
+
+        void Relabel()
+        {
+            uint64_t order = 0;
+            for (auto index = 0u; index != End; index = Next[index])
+            {
+                Order[index] = order;
+                order += uint64_t{ 1 } << OrderSpacingBits;
+            }
+        }
+    };
+} // namespace
+
+// Same as RemapPositionToQuadrant but without the offsets that keep the index positive.
+template<uint8_t TRotation> static int64_t GetQuadrantKey(const PaintStructBoundBox& bbox)
+{
+    if constexpr (TRotation == 0)
+        return int64_t{ bbox.x } + bbox.y;
+    else if constexpr (TRotation == 1)
+        return int64_t{ bbox.y } - bbox.x;
+    else if constexpr (TRotation == 2)
+        return -(int64_t{ bbox.x } + bbox.y);
+    else
+        return int64_t{ bbox.x } - bbox.y;
+}
+
+// Returns the range of x positions a node can have for CheckBoundingBox to pass against initialBBox, given
+// that no node has a quadrant key below minKey. The key ties x to y, which bounds the otherwise open range.
+template<uint8_t TRotation>
+static std::pair<int64_t, int64_t> GetCandidateRangeX(const PaintStructBoundBox& initialBBox, int64_t minKey)
+{
+    if constexpr (TRotation == 0)
+        return { minKey - initialBBox.y_end, initialBBox.x_end };
+    else if constexpr (TRotation == 1)
+        return { int64_t{ initialBBox.x_end } + 1, initialBBox.y_end - minKey };
+    else if constexpr (TRotation == 2)
+        return { int64_t{ initialBBox.x_end } + 1, -minKey - initialBBox.y_end - 1 };
+    else
+        return { minKey + initialBBox.y_end + 1, initialBBox.x_end };
+}
+
+// Produces exactly the same order as PaintArrangeStructsHelperRotation. Instead of comparing a visited node
+// against every following node, only the neighbours whose x position can intersect are looked up and their
+// order in the list is checked with the order labels.
+template<uint8_t TRotation>
+static PaintStruct* PaintArrangeStructsBucketedRotation(
+    PaintSortBuckets& buckets, PaintStruct* psQuadrantEntry, uint16_t quadrantIndex, uint8_t flag)
+{
+    constexpr auto End = PaintSortBuckets::End;
+
+    psQuadrantEntry = PaintStructsFirstInQuadrant(psQuadrantEntry, quadrantIndex);
+    PaintStructsInitializeSort(psQuadrantEntry, quadrantIndex, flag);
+
+    // Gather the nodes the legacy sort would traverse, the quadrant entry itself is the head at index 0.
+    auto& nodes = buckets.Nodes;
+    nodes.clear();
+    nodes.push_back(psQuadrantEntry);
+    auto* psEnd = psQuadrantEntry->NextQuadrantEntry;
+    while (psEnd != nullptr && !(psEnd->SortFlags & PaintSortFlags::OutsideQuadrant))
+    {
+        nodes.push_back(psEnd);
+        psEnd = psEnd->NextQuadrantEntry;
+    }
+
+    const auto count = static_cast<uint32_t>(nodes.size());
+    if (count == 1)
+    {
+        return psQuadrantEntry;
+    }
+
+    auto& next = buckets.Next;
+    auto& prev = buckets.Prev;
+    auto& order = buckets.Order;
+    auto& neighbours = buckets.Neighbours;
+    auto& groups = buckets.Groups;
+    next.resize(count);
+    prev.resize(count);
+    order.resize(count);
+    neighbours.clear();
+    groups.clear();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        next[i] = i + 1 < count ? i + 1 : End;
+        prev[i] = i > 0 ? i - 1 : End;
+        order[i] = uint64_t{ i } << PaintSortBuckets::OrderSpacingBits;
+        if (i > 0 && (nodes[i]->SortFlags & PaintSortFlags::Neighbour))
+        {
+            neighbours.push_back({ nodes[i]->Bounds, nodes[i]->QuadrantIndex, i });
+        }
+    }
+
+    // Most neighbours are in the next quadrant, but nodes that were left behind by earlier passes can still be
+    // flagged as neighbour. Grouping by quadrant keeps those from widening the candidate range of the others.
+    std::sort(neighbours.begin(), neighbours.end(), [](const auto& a, const auto& b) {
+        return a.QuadrantIndex != b.QuadrantIndex ? a.QuadrantIndex < b.QuadrantIndex : a.Bounds.x < b.Bounds.x;
+    });
+    for (uint32_t i = 0; i < neighbours.size(); i++)
+    {
+        if (groups.empty() || neighbours[groups.back().Begin].QuadrantIndex != neighbours[i].QuadrantIndex)
+        {
+            groups.push_back({ i, i, std::numeric_limits<int64_t>::max() });
+        }
+        auto& group = groups.back();
+        group.End = i + 1;
+        group.MinKey = std::min(group.MinKey, GetQuadrantKey<TRotation>(neighbours[i].Bounds));
+    }
+
+    auto& matches = buckets.Matches;
+    uint32_t parent = 0;
+    for (;;)
+    {
+        // Same as PaintStructsGetNextPending.
+        auto child = next[parent];
+        while (child != End && !(nodes[child]->SortFlags & PaintSortFlags::PendingVisit))
+        {
+            parent = child;
+            child = next[child];
+        }
+        if (child == End)
+        {
+            break;
+        }
+
+        nodes[child]->SortFlags &= ~PaintSortFlags::PendingVisit;
+
+        // Every following neighbour that intersects is moved behind the parent, the last one ends up first.
+        const auto initialBBox = nodes[child]->Bounds;
+        const auto childOrder = order[child];
+        matches.clear();
+        for (const auto& group : groups)
+        {
+            const auto [minX, maxX] = GetCandidateRangeX<TRotation>(initialBBox, group.MinKey);
+            auto it = std::lower_bound(
+                neighbours.begin() + group.Begin, neighbours.begin() + group.End, minX,
+                [](const auto& neighbour, int64_t x) { return neighbour.Bounds.x < x; });
+            for (; it != neighbours.begin() + group.End && it->Bounds.x <= maxX; it++)
+            {
+                if (CheckBoundingBox<TRotation>(initialBBox, it->Bounds) && order[it->Index] > childOrder)
+                {
+                    matches.push_back(it->Index);
+                }
+            }
+        }
+        if (matches.empty())
+        {
+            continue;
+        }
+        std::sort(matches.begin(), matches.end(), [&order](uint32_t a, uint32_t b) { return order[a] > order[b]; });
+
+        for (auto match : matches)
+        {
+            next[prev[match]] = next[match];
+            if (next[match] != End)
+            {
+                prev[next[match]] = prev[match];
+            }
+        }
+        auto before = parent;
+        for (auto match : matches)
+        {
+            prev[match] = before;
+            next[before] = match;
+            before = match;
+        }
+        next[before] = child;
+        prev[child] = before;
+
+        const auto gap = order[child] - order[parent];
+        if (gap <= matches.size())
+        {
+            buckets.Relabel();
+        }
+        else
+        {
+            const auto step = gap / (matches.size() + 1);
+            for (size_t i = 0; i < matches.size(); i++)
+            {
+                order[matches[i]] = order[parent] + step * (i + 1);
+            }
+        }
+    }
+
+    // Write the new order back to the linked list.
+    for (auto index = 0u; index != End; index = next[index])
+    {
+        nodes[index]->NextQuadrantEntry = next[index] != End ? nodes[next[index]] : psEnd;
+    }
+
+    return psQuadrantEntry;
+}
+
+template<int TRotation> static void PaintSessionArrangeBucketedImpl(PaintSessionCore& session)
+{
+    uint32_t quadrantIndex = session.QuadrantBackIndex;
+    if (quadrantIndex == UINT32_MAX)
+    {
+        return;
+    }
+
+    // Sessions are arranged on multiple threads, each keeps its own scratch space between calls.
+    thread_local PaintSortBuckets buckets;
+
+    PaintStruct psHead{};
+    PaintStructsLinkQuadrants(session, psHead);
+
+    PaintStruct* psNextQuadrant = PaintArrangeStructsBucketedRotation<TRotation>(
+        buckets, &psHead, session.QuadrantBackIndex, PaintSortFlags::Neighbour);
+
+    while (++quadrantIndex < session.QuadrantFrontIndex)
+    {
+        psNextQuadrant = PaintArrangeStructsBucketedRotation<TRotation>(
+            buckets, psNextQuadrant, quadrantIndex, PaintSortFlags::None);
+    }
+
+    session.PaintHead = psHead.NextQuadrantEntry;
+}
+
 using PaintArrangeWithRotation = void (*)(PaintSessionCore& session);
 
 constexpr std::array _paintArrangeFuncs = {
@@ -503,13 +757,29 @@ constexpr std::array _paintArrangeFuncs = {
     PaintSessionArrangeImpl<3>,
 };
 
+constexpr std::array _paintArrangeBucketedFuncs = {
+    PaintSessionArrangeBucketedImpl<0>,
+    PaintSessionArrangeBucketedImpl<1>,
+    PaintSessionArrangeBucketedImpl<2>,
+    PaintSessionArrangeBucketedImpl<3>,
+};
+
 /**
  *
  *  rct2: 0x00688217
  */
 void PaintSessionArrange(PaintSessionCore& session)
+{
+    PaintSessionArrange(session, gConfigGeneral.BucketedPaintSort ? PaintSortMode::Bucketed : PaintSortMode::Legacy);
+}
+
+void PaintSessionArrange(PaintSessionCore& session, PaintSortMode mode)
 {
     PROFILED_FUNCTION();
+    if (mode == PaintSortMode::Bucketed)
+    {
+        return _paintArrangeBucketedFuncs[session.CurrentRotation](session);
+    }
     return _paintArrangeFuncs[session.CurrentRotation](session);
 }
 
@@ -966,14 +1236,23 @@ PaintEntry* PaintEntryPool::Chain::Allocate()
     }
     else if (Current->Count >= NodeSize)
     {
-        // We need another node
-        Current->Next = Pool->AllocateNode();
-        if (Current->Next == nullptr)
+        if (Current->Next != nullptr)
         {
-            // Unable to allocate any more nodes
-            return nullptr;
+            // Re-use a node kept from before the chain was reset
+            Current = Current->Next;
+            Current->Count = 0;
+        }
+        else
+        {
+            // We need another node
+            Current->Next = Pool->AllocateNode();
+            if (Current->Next == nullptr)
+            {
+                // Unable to allocate any more nodes
+                return nullptr;
+            }
+            Current = Current->Next;
         }
-        Current = Current->Next;
     }
 
     assert(Current->Count < NodeSize);
@@ -992,6 +1271,15 @@ void PaintEntryPool::Chain::Clear()
     assert(Current == nullptr);
 }
 
+void PaintEntryPool::Chain::Reset()
+{
+    Current = Head;
+    if (Current != nullptr)
+    {
+        Current->Count = 0;
+    }
+}
+
 size_t PaintEntryPool::Chain::GetCount() const
 {
     size_t count = 0;
@@ -999,6 +1287,11 @@ size_t PaintEntryPool::Chain::GetCount() const
     while (current != nullptr)
     {
         count += current->Count;
+        if (current == Current)
+        {
+            // Nodes after the current one are left over from before a reset
+            break;
+        }
         current = current->Next;
     }
     return count;
@@ -1013,6 +1306,11 @@ PaintEntryPool::~PaintEntryPool()
     _available.clear();
 }
 
+size_t PaintEntryPool::GetNodeCount() const
+{
+    return _nodeCount;
+}
+
 PaintEntryPool::Node* PaintEntryPool::AllocateNode()
 {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -1026,6 +1324,10 @@ PaintEntryPool::Node* PaintEntryPool::AllocateNode()
     else
     {
         result = new (std::nothrow) PaintEntryPool::Node();
+        if (result != nullptr)
+        {
+            _nodeCount++;
+        }
     }
     return result;
 }
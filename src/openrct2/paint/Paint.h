@@ -17,6 +17,7 @@
 #include "../world/Map.h"
 #include "Boundbox.h"
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 
@@ -121,6 +122,14 @@ struct TunnelEntry
     uint8_t type;
 };
 
+enum class PaintSortMode : uint8_t
+{
+    // Compares every visited paint struct against all following ones in its quadrant range.
+    Legacy,
+    // Same order as Legacy, but only looks at the neighbours whose position can intersect.
+    Bucketed,
+};
+
 // The maximum size must be MAXIMUM_MAP_SIZE_TECHNICAL multiplied by 2 because
 // the quadrant index is based on the x and y components combined.
 static constexpr int32_t MaxPaintQuadrants = MAXIMUM_MAP_SIZE_TECHNICAL * 2;
@@ -161,12 +170,15 @@ public:
 
         PaintEntry* Allocate();
         void Clear();
+        // Empties the chain but keeps its nodes so they can be reused without going through the pool.
+        void Reset();
         size_t GetCount() const;
     };
 
 private:
     std::vector<Node*> _available;
     std::mutex _mutex;
+    std::atomic<size_t> _nodeCount{};
 
     Node* AllocateNode();
 
@@ -175,6 +187,7 @@ public:
 
     Chain Create();
     void FreeNodes(Node* head);
+    size_t GetNodeCount() const;
 };
 
 struct PaintSessionCore
@@ -342,5 +355,6 @@ PaintSession* PaintSessionAlloc(DrawPixelInfo& dpi, uint32_t viewFlags);
 void PaintSessionFree(PaintSession* session);
 void PaintSessionGenerate(PaintSession& session);
 void PaintSessionArrange(PaintSessionCore& session);
+void PaintSessionArrange(PaintSessionCore& session, PaintSortMode mode);
 void PaintDrawStructs(PaintSession& session);
 void PaintDrawMoneyStructs(DrawPixelInfo& dpi, PaintStringStruct* ps);
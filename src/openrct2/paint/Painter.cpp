@@ -25,6 +25,7 @@
 #include "../profiling/Profiling.h"
 #include "../title/TitleScreen.h"
 #include "../ui/UiContext.h"
+#include "../world/Map.h"
 #include "../world/TileInspector.h"
 
 using namespace OpenRCT2;
@@ -41,6 +42,11 @@ void Painter::Paint(IDrawingEngine& de)
 {
     PROFILED_FUNCTION();
 
+    _lastFramePeakEntries = _framePeakEntries;
+    _framePeakEntries = 0;
+
+    MapFlushInvalidatedTiles();
+
     auto dpi = de.GetDrawingPixelInfo();
     if (gIntroState != IntroState::None)
     {
@@ -80,6 +86,7 @@ void Painter::Paint(IDrawingEngine& de)
     if (gConfigGeneral.ShowFPS)
     {
         PaintFPS(*dpi);
+        PaintSpriteCacheStats(*dpi, de);
     }
     gCurrentDrawCount++;
 }
@@ -119,6 +126,30 @@ void Painter::PaintFPS(DrawPixelInfo& dpi)
     GfxSetDirtyBlocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { dpi.lastStringPos.x + 16, 16 } });
 }
 
+void Painter::PaintSpriteCacheStats(DrawPixelInfo& dpi, IDrawingEngine& de)
+{
+    const auto stats = de.GetSpriteCacheStats();
+    const auto lookups = stats.Hits + stats.Misses;
+    if (lookups == 0)
+    {
+        return;
+    }
+
+    ScreenCoordsXY screenCoords(_uiContext->GetWidth() / 2, 14);
+
+    char buffer[128]{};
+    FormatStringToBuffer(
+        buffer, sizeof(buffer), "{OUTLINE}{WHITE}Sprite cache: {INT32}% hits, {INT32} sprites, {INT32} KiB",
+        static_cast<int32_t>(stats.Hits * 100 / lookups), static_cast<int32_t>(stats.Sprites),
+        static_cast<int32_t>(stats.MemoryUsage / 1024));
+
+    int32_t stringWidth = GfxGetStringWidth(buffer, FontStyle::Medium);
+    screenCoords.x = screenCoords.x - (stringWidth / 2);
+    GfxDrawString(dpi, screenCoords, buffer);
+
+    GfxSetDirtyBlocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { dpi.lastStringPos.x + 16, 28 } });
+}
+
 void Painter::MeasureFPS()
 {
     _frames++;
@@ -138,9 +169,11 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags)
 
     PaintSession* session = nullptr;
 
+    std::unique_lock<std::mutex> lock(_sessionMutex);
     if (_freePaintSessions.empty() == false)
     {
-        // Re-use.
+        // Re-use, the session still owns the paint entry nodes from its previous use and its
+        // quadrants have been cleared on release.
         session = _freePaintSessions.back();
 
         // Shrink by one.
@@ -151,16 +184,18 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags)
         // Create new one in pool.
         _paintSessionPool.emplace_back(std::make_unique<PaintSession>());
         session = _paintSessionPool.back().get();
+        session->PaintEntryChain = _paintStructPool.Create();
+        std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     }
+    _peakSessionsInUse = std::max(_peakSessionsInUse, _paintSessionPool.size() - _freePaintSessions.size());
+    lock.unlock();
 
     session->DPI = dpi;
     session->ViewFlags = viewFlags;
     session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
     session->QuadrantFrontIndex = 0;
-    session->PaintEntryChain = _paintStructPool.Create();
     session->Flags = 0;
 
-    std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->PaintHead = nullptr;
     session->LastPS = nullptr;
     session->LastAttachedPS = nullptr;
@@ -179,15 +214,42 @@ void Painter::ReleaseSession(PaintSession* session)
 {
     PROFILED_FUNCTION();
 
-    session->PaintEntryChain.Clear();
+    const auto entryCount = session->PaintEntryChain.GetCount();
+
+    // Only the quadrants between the back and front index can have been written to.
+    if (session->QuadrantBackIndex <= session->QuadrantFrontIndex)
+    {
+        std::fill(
+            std::begin(session->Quadrants) + session->QuadrantBackIndex,
+            std::begin(session->Quadrants) + session->QuadrantFrontIndex + 1, nullptr);
+    }
+
+    // Keep the nodes with the session so the next frame does not have to go through the pool again.
+    session->PaintEntryChain.Reset();
+
+    std::lock_guard<std::mutex> lock(_sessionMutex);
+    _framePeakEntries = std::max(_framePeakEntries, entryCount);
+    _peakEntries = std::max(_peakEntries, entryCount);
     _freePaintSessions.push_back(session);
 }
 
+PaintSessionStats Painter::GetSessionStats() const
+{
+    std::lock_guard<std::mutex> lock(_sessionMutex);
+    PaintSessionStats stats;
+    stats.Sessions = _paintSessionPool.size();
+    stats.PeakSessionsInUse = _peakSessionsInUse;
+    stats.EntryNodes = _paintStructPool.GetNodeCount();
+    stats.LastFramePeakEntries = _lastFramePeakEntries;
+    stats.PeakEntries = _peakEntries;
+    return stats;
+}
+
 Painter::~Painter()
 {
     for (auto&& session : _paintSessionPool)
     {
-        ReleaseSession(session.get());
+        session->PaintEntryChain.Clear();
     }
     _paintSessionPool.clear();
 }
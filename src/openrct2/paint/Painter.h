@@ -14,6 +14,7 @@
 
 #include <ctime>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 struct DrawPixelInfo;
@@ -32,16 +33,35 @@ namespace OpenRCT2
 
     namespace Paint
     {
+        struct PaintSessionStats
+        {
+            // Sessions owned by the painter, they are kept between frames.
+            size_t Sessions{};
+            // Most sessions that were in use at the same time.
+            size_t PeakSessionsInUse{};
+            // Paint entry nodes allocated from the pool, including the ones held by idle sessions.
+            size_t EntryNodes{};
+            // Most paint entries used by a single session during the last frame and ever.
+            size_t LastFramePeakEntries{};
+            size_t PeakEntries{};
+        };
+
         struct Painter final
         {
         private:
             std::shared_ptr<Ui::IUiContext> const _uiContext;
             std::vector<std::unique_ptr<PaintSession>> _paintSessionPool;
             std::vector<PaintSession*> _freePaintSessions;
+            // Sessions are created and released by every thread that paints a viewport.
+            mutable std::mutex _sessionMutex;
             PaintEntryPool _paintStructPool;
             time_t _lastSecond = 0;
             int32_t _currentFPS = 0;
             int32_t _frames = 0;
+            size_t _peakSessionsInUse = 0;
+            size_t _framePeakEntries = 0;
+            size_t _lastFramePeakEntries = 0;
+            size_t _peakEntries = 0;
 
         public:
             explicit Painter(const std::shared_ptr<Ui::IUiContext>& uiContext);
@@ -49,11 +69,13 @@ namespace OpenRCT2
 
             PaintSession* CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags);
             void ReleaseSession(PaintSession* session);
+            PaintSessionStats GetSessionStats() const;
             ~Painter();
 
         private:
             void PaintReplayNotice(DrawPixelInfo& dpi, const char* text);
             void PaintFPS(DrawPixelInfo& dpi);
+            void PaintSpriteCacheStats(DrawPixelInfo& dpi, Drawing::IDrawingEngine& de);
             void MeasureFPS();
         };
     } // namespace Paint
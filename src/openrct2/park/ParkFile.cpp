@@ -57,6 +57,7 @@
 #include "../world/Scenery.h"
 #include "Legacy.h"
 
+#include <chrono>
 #include <cstdint>
 #include <ctime>
 #include <numeric>
@@ -102,6 +103,7 @@ namespace OpenRCT2
         ObjectList RequiredObjects;
         std::vector<const ObjectRepositoryItem*> ExportObjectsList;
         bool OmitTracklessRides{};
+        uint32_t Compression = OrcaStream::COMPRESSION_GZIP_CHUNKS;
 
     private:
         std::unique_ptr<OrcaStream> _os;
@@ -146,6 +148,7 @@ namespace OpenRCT2
         void Import()
         {
             auto& os = *_os;
+            os.DecompressChunks();
             ReadWriteTilesChunk(os);
             ReadWriteBannersChunk(os);
             ReadWriteRidesChunk(os);
@@ -177,6 +180,7 @@ namespace OpenRCT2
             header.Magic = PARK_FILE_MAGIC;
             header.TargetVersion = PARK_FILE_CURRENT_VERSION;
             header.MinVersion = PARK_FILE_MIN_VERSION;
+            header.Compression = Compression;
 
             ReadWriteAuthoringChunk(os);
             ReadWriteObjectsChunk(os);
@@ -2523,6 +2527,10 @@ void ParkFileExporter::Export(IStream& stream)
 {
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
     parkFile->ExportObjectsList = ExportObjectsList;
+    if (!Compress)
+    {
+        parkFile->Compression = OrcaStream::COMPRESSION_NONE;
+    }
     parkFile->Save(stream);
 }
 
@@ -2612,6 +2620,54 @@ int32_t ScenarioSave(u8string_view path, int32_t flags)
     return result;
 }
 
+std::future<bool> ScenarioSaveAsync(u8string_view path, int32_t flags)
+{
+    LOG_VERBOSE("saving game in the background");
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    gIsAutosave = flags & S6_SAVE_FLAG_AUTOMATIC;
+    PrepareMapForSave();
+
+    // Serialise all chunks without compression, this is the only part that needs the game state.
+    auto snapshot = std::make_unique<OpenRCT2::MemoryStream>();
+    try
+    {
+        auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
+        parkFile->OmitTracklessRides = true;
+        parkFile->Compression = OrcaStream::COMPRESSION_NONE;
+        parkFile->Save(*snapshot);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(e.what());
+
+        std::promise<bool> failed;
+        failed.set_value(false);
+        return failed.get_future();
+    }
+
+    const auto endTime = std::chrono::high_resolution_clock::now();
+    LOG_INFO(
+        "Saving %s paused the game for %.2f ms", u8string(path).c_str(),
+        std::chrono::duration<double, std::milli>(endTime - startTime).count());
+
+    return std::async(std::launch::async, [snapshot = std::move(snapshot), path = u8string(path)]() {
+        try
+        {
+            snapshot->SetPosition(0);
+            FileStream fs(path, FILE_MODE_WRITE);
+            OrcaStream::Compress(*snapshot, fs, OrcaStream::COMPRESSION_GZIP_CHUNKS);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Unable to save %s: %s", path.c_str(), e.what());
+            return false;
+        }
+    });
+}
+
 class ParkFileImporter final : public IParkImporter
 {
 private:
@@ -9,10 +9,10 @@ struct ObjectRepositoryItem;
 namespace OpenRCT2
 {
     // Current version that is saved.
-    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 33;
+    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 34;
 
     // The minimum version that is forwards compatible with the current version.
-    constexpr uint32_t PARK_FILE_MIN_VERSION = 33;
+    constexpr uint32_t PARK_FILE_MIN_VERSION = 34;
 
     // The minimum version that is backwards compatible with the current version.
     // If this is increased beyond 0, uncomment the checks in ParkFile.cpp and Context.cpp!
@@ -27,6 +27,8 @@ class ParkFileExporter
 {
 public:
     std::vector<const ObjectRepositoryItem*> ExportObjectsList;
+    // Writes the chunks without compression when false, they can be compressed later with OrcaStream::Compress.
+    bool Compress = true;
 
     void Export(std::string_view path);
     void Export(OpenRCT2::IStream& stream);
@@ -1783,51 +1783,43 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
  */
 Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection)
 {
-    Staff* closestMechanic = nullptr;
-    uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
+    const auto location = entrancePosition.ToTileStart();
+    const bool checkPatrolArea = MapIsLocationInPark(location);
 
-    for (auto peep : EntityList<Staff>())
-    {
+    // Manhattan distance
+    const auto getDistance = [&entrancePosition](const Staff* peep) {
+        return std::abs(peep->x - entrancePosition.x) + std::abs(peep->y - entrancePosition.y);
+    };
+    const auto isAvailable = [&](const Staff* peep) {
         if (!peep->IsMechanic())
-            continue;
+            return false;
 
         if (!forInspection)
         {
             if (peep->State == PeepState::HeadingToInspection)
             {
                 if (peep->SubState >= 4)
-                    continue;
+                    return false;
             }
             else if (peep->State != PeepState::Patrolling)
-                continue;
+                return false;
 
             if (!(peep->StaffOrders & STAFF_ORDERS_FIX_RIDES))
-                continue;
+                return false;
         }
         else
         {
             if (peep->State != PeepState::Patrolling || !(peep->StaffOrders & STAFF_ORDERS_INSPECT_RIDES))
-                continue;
+                return false;
         }
 
-        auto location = entrancePosition.ToTileStart();
-        if (MapIsLocationInPark(location))
-            if (!peep->IsLocationInPatrol(location))
-                continue;
-
-        if (peep->x == LOCATION_NULL)
-            continue;
+        if (checkPatrolArea && !peep->IsLocationInPatrol(location))
+            return false;
 
-        // Manhattan distance
-        uint32_t distance = std::abs(peep->x - entrancePosition.x) + std::abs(peep->y - entrancePosition.y);
-        if (distance < closestDistance)
-        {
-            closestDistance = distance;
-            closestMechanic = peep;
-        }
-    }
+        return true;
+    };
 
-    return closestMechanic;
+    return GetNearestEntity<Staff>(entrancePosition, std::numeric_limits<int32_t>::max(), getDistance, isAvailable);
 }
 
 Staff* RideGetMechanic(const Ride& ride)
@@ -1798,7 +1798,12 @@ static int32_t ride_ratings_get_scenery_score(const Ride& ride)
         for (int32_t xx = std::max(tileLocation.x - 5, 0); xx <= std::min(tileLocation.x + 5, gMapSize.x - 1); xx++)
         {
             // Count scenery items on this tile
-            TileElement* tileElement = MapGetFirstElementAt(TileCoordsXY{ xx, yy });
+            const auto tilePos = TileCoordsXY{ xx, yy };
+            if (!MapTileHasElementType(tilePos, TileElementType::SmallScenery)
+                && !MapTileHasElementType(tilePos, TileElementType::LargeScenery))
+                continue;
+
+            TileElement* tileElement = MapGetFirstElementAt(tilePos);
             if (tileElement == nullptr)
                 continue;
             do
@@ -29,6 +29,7 @@
 #include "../actions/WallPlaceAction.h"
 #include "../actions/WallRemoveAction.h"
 #include "../audio/audio.h"
+#include "../config/Config.h"
 #include "../core/DataSerialiser.h"
 #include "../core/File.h"
 #include "../core/Numerics.hpp"
@@ -2166,7 +2167,8 @@ void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
         gCurrentRotation = i;
 
         view.viewPos = Translate3DTo2DWithZ(i, centre) - offset;
-        ViewportPaint(&view, dpi, { view.viewPos, view.viewPos + ScreenCoordsXY{ size_x, size_y } });
+        ViewportPaint(
+            &view, dpi, { view.viewPos, view.viewPos + ScreenCoordsXY{ size_x, size_y } }, gConfigGeneral.MultiThreading);
 
         dpi.bits += TRACK_PREVIEW_IMAGE_SIZE;
     }
@@ -265,6 +265,8 @@ static void ScenarioCheckEntranceFeeTooHigh()
 
 void ScenarioAutosaveCheck()
 {
+    GameAutosaveUpdate();
+
     if (gLastAutoSaveUpdate == AUTOSAVE_PAUSE)
         return;
 
@@ -21,6 +21,8 @@
 #include "../world/Map.h"
 #include "../world/MapAnimation.h"
 
+#include <future>
+
 struct ResultWithMessage;
 
 using random_engine_t = Random::RCT2::Engine;
@@ -185,6 +187,12 @@ uint32_t ScenarioRandMax(uint32_t max);
 
 ResultWithMessage ScenarioPrepareForSave();
 int32_t ScenarioSave(u8string_view path, int32_t flags);
+
+/**
+ * Serialises the park on the calling thread, compression and writing the file happen on a background thread.
+ * @returns Whether the file was written successfully, once the background thread has completed.
+ */
+std::future<bool> ScenarioSaveAsync(u8string_view path, int32_t flags);
 void ScenarioFailure();
 void ScenarioSuccess();
 void ScenarioSuccessSubmitName(const char* name);
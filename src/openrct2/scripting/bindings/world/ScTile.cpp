@@ -125,6 +125,7 @@ namespace OpenRCT2::Scripting
                     first[numElements - 1].SetLastForTile(true);
                 }
             }
+            MapUpdateTileElementTypes(TileCoordsXY(_coords));
             MapInvalidateTileFull(_coords);
         }
     }
@@ -86,6 +86,7 @@ namespace OpenRCT2::Scripting
             return;
         }
 
+        MapUpdateTileElementTypes(TileCoordsXY(_coords));
         Invalidate();
     }
 
@@ -121,6 +121,9 @@ static bool entrance_has_direction(const EntranceElement& entranceElement, int32
 
 PathElement* MapGetFootpathElement(const CoordsXYZ& coords)
 {
+    if (!MapTileHasElementType(TileCoordsXY{ coords }, TileElementType::Path))
+        return nullptr;
+
     TileElement* tileElement = MapGetFirstElementAt(coords);
     do
     {
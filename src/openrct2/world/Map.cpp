@@ -40,6 +40,7 @@
 #include "../scenario/Scenario.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
+#include "../world/TileElementTypeIndex.hpp"
 #include "../world/TilePointerIndex.hpp"
 #include "Banner.h"
 #include "Climate.h"
@@ -55,6 +56,8 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -108,8 +111,10 @@ uint32_t gLandRemainingConstructionSales;
 bool gMapLandRightsUpdateSuccess;
 
 static TilePointerIndex<TileElement> _tileIndex;
+static TileElementTypeIndex _tileTypeIndex;
 static std::vector<TileElement> _tileElements;
 static TilePointerIndex<TileElement> _tileIndexStash;
+static TileElementTypeIndex _tileTypeIndexStash;
 static std::vector<TileElement> _tileElementsStash;
 static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
@@ -119,6 +124,7 @@ static int32_t _currentRotationStash;
 void StashMap()
 {
     _tileIndexStash = std::move(_tileIndex);
+    _tileTypeIndexStash = std::move(_tileTypeIndex);
     _tileElementsStash = std::move(_tileElements);
     _mapSizeStash = gMapSize;
     _currentRotationStash = gCurrentRotation;
@@ -128,6 +134,7 @@ void StashMap()
 void UnstashMap()
 {
     _tileIndex = std::move(_tileIndexStash);
+    _tileTypeIndex = std::move(_tileTypeIndexStash);
     _tileElements = std::move(_tileElementsStash);
     gMapSize = _mapSizeStash;
     gCurrentRotation = _currentRotationStash;
@@ -143,6 +150,7 @@ void SetTileElements(std::vector<TileElement>&& tileElements)
 {
     _tileElements = std::move(tileElements);
     _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
+    _tileTypeIndex = TileElementTypeIndex(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
     _tileElementsInUse = _tileElements.size();
 }
 
@@ -373,6 +381,9 @@ TileElement* MapGetNthElementAt(const CoordsXY& coords, int32_t n)
 
 TileElement* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc, TileElementType type)
 {
+    if (!MapTileHasElementType(loc, type))
+        return nullptr;
+
     TileElement* tileElement = MapGetFirstElementAt(loc);
     if (tileElement == nullptr)
         return nullptr;
@@ -395,6 +406,25 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    _tileTypeIndex.SetTile(tilePos, elements);
+}
+
+bool MapTileHasElementType(const TileCoordsXY& tilePos, TileElementType type)
+{
+    if (!IsTileLocationValid(tilePos))
+    {
+        return false;
+    }
+    return _tileTypeIndex.HasType(tilePos, type);
+}
+
+void MapUpdateTileElementTypes(const TileCoordsXY& tilePos)
+{
+    if (!IsTileLocationValid(tilePos))
+    {
+        return;
+    }
+    _tileTypeIndex.SetTile(tilePos, _tileIndex.GetFirstElementAt(tilePos));
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords)
@@ -1157,6 +1187,7 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    _tileTypeIndex.AddType(tileLoc, type);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -1755,23 +1786,87 @@ ScreenCoordsXY Translate3DTo2DWithZ(int32_t rotation, const CoordsXYZ& pos)
     return ScreenCoordsXY{ rotated.y - rotated.x, ((rotated.x + rotated.y) >> 1) - pos.z };
 }
 
-static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
+namespace
 {
-    if (gOpenRCT2Headless)
-        return;
+    struct InvalidatedTile
+    {
+        CoordsXY Pos;
+        int32_t MinZ;
+        int32_t MaxZ;
+        ZoomLevel MaxZoom;
+    };
+} // namespace
 
+// Tiles invalidated since the last frame, the same tile is often invalidated many times per tick
+// (e.g. by map animations) so they are merged and only turned into screen rectangles once per frame.
+// This only removes duplicate invalidations, the dirty blocks they produce are still painted from
+// scratch and entity moves still invalidate their sprite bounds directly.
+// All tiles in the table were invalidated under the same rotation, it is flushed when the rotation changes.
+static constexpr size_t MaxInvalidatedTiles = 4096;
+static std::vector<InvalidatedTile> _invalidatedTiles;
+static std::unordered_map<uint64_t, size_t> _invalidatedTileIndices;
+static int32_t _invalidatedTilesRotation;
+
+static void MapInvalidateTileRect(const InvalidatedTile& tile)
+{
     int32_t x1, y1, x2, y2;
 
-    x += 16;
-    y += 16;
-    auto screenCoord = Translate3DTo2D(GetCurrentRotation(), { x, y });
+    auto screenCoord = Translate3DTo2D(_invalidatedTilesRotation, { tile.Pos.x + 16, tile.Pos.y + 16 });
 
     x1 = screenCoord.x - 32;
-    y1 = screenCoord.y - 32 - z1;
+    y1 = screenCoord.y - 32 - tile.MaxZ;
     x2 = screenCoord.x + 32;
-    y2 = screenCoord.y + 32 - z0;
+    y2 = screenCoord.y + 32 - tile.MinZ;
+
+    ViewportsInvalidate({ { x1, y1 }, { x2, y2 } }, tile.MaxZoom);
+}
+
+void MapFlushInvalidatedTiles()
+{
+    PROFILED_FUNCTION();
+
+    for (const auto& tile : _invalidatedTiles)
+    {
+        MapInvalidateTileRect(tile);
+    }
+    _invalidatedTiles.clear();
+    _invalidatedTileIndices.clear();
+}
+
+static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
+{
+    if (gOpenRCT2Headless)
+        return;
+
+    // The screen position of a tile depends on the rotation, tiles invalidated before rotating are flushed first.
+    const auto rotation = GetCurrentRotation();
+    if (rotation != _invalidatedTilesRotation)
+    {
+        MapFlushInvalidatedTiles();
+        _invalidatedTilesRotation = rotation;
+    }
+
+    const auto key = (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    auto it = _invalidatedTileIndices.find(key);
+    if (it != _invalidatedTileIndices.end())
+    {
+        auto& tile = _invalidatedTiles[it->second];
+        tile.MinZ = std::min(tile.MinZ, z0);
+        tile.MaxZ = std::max(tile.MaxZ, z1);
+        // -1 means the tile is invalidated at every zoom level.
+        if (tile.MaxZoom != ZoomLevel{ -1 } && (maxZoom == ZoomLevel{ -1 } || maxZoom > tile.MaxZoom))
+        {
+            tile.MaxZoom = maxZoom;
+        }
+        return;
+    }
 
-    ViewportsInvalidate({ { x1, y1 }, { x2, y2 } }, maxZoom);
+    if (_invalidatedTiles.size() >= MaxInvalidatedTiles)
+    {
+        MapFlushInvalidatedTiles();
+    }
+    _invalidatedTileIndices.emplace(key, _invalidatedTiles.size());
+    _invalidatedTiles.push_back({ { x, y }, z0, z1, maxZoom });
 }
 
 /**
@@ -162,6 +162,13 @@ TileElement* MapGetFirstElementAt(const TileCoordsXY& tilePos);
 TileElement* MapGetNthElementAt(const CoordsXY& coords, int32_t n);
 TileElement* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc, TileElementType type);
 void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements);
+/**
+ * Returns false if the tile has no element of the given type. Elements that have been removed since the
+ * tile was last updated can still be reported as present.
+ */
+bool MapTileHasElementType(const TileCoordsXY& tilePos, TileElementType type);
+// Must be called after elements of a tile have been overwritten in place, e.g. changing their type.
+void MapUpdateTileElementTypes(const TileCoordsXY& tilePos);
 int32_t MapHeightFromSlope(const CoordsXY& coords, int32_t slopeDirection, bool isSloped);
 BannerElement* MapGetBannerElementAt(const CoordsXYZ& bannerPos, uint8_t direction);
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords);
@@ -242,6 +249,12 @@ void MapInvalidateTileFull(const CoordsXY& tilePos);
 void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement);
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs);
 
+/**
+ * Tile invalidations are collected and merged per tile, this turns them into dirty screen areas of
+ * the viewports. Called once per frame before the dirty areas are drawn.
+ */
+void MapFlushInvalidatedTiles();
+
 int32_t MapGetTileSide(const CoordsXY& mapPos);
 int32_t MapGetTileQuadrant(const CoordsXY& mapPos);
 int32_t MapGetCornerHeight(int32_t z, int32_t slope, int32_t direction);
@@ -39,6 +39,7 @@
 #include "../windows/Intent.h"
 #include "Entrance.h"
 #include "Map.h"
+#include "ParkStatistics.h"
 #include "Surface.h"
 
 #include <algorithm>
@@ -316,11 +317,12 @@ void Park::Update(const Date& date)
     // Every ~13 seconds
     if (gCurrentTicks % 512 == 0)
     {
-        gParkRating = CalculateParkRating();
-        gParkValue = CalculateParkValue();
+        const auto stats = GatherParkStatistics();
+        gParkRating = CalculateParkRating(stats);
+        gParkValue = CalculateParkValue(stats);
         gCompanyValue = CalculateCompanyValue();
-        gTotalRideValueForMoney = CalculateTotalRideValueForMoney();
-        _suggestedGuestMaximum = CalculateSuggestedMaxGuests();
+        gTotalRideValueForMoney = stats.TotalRideValueForMoney;
+        _suggestedGuestMaximum = CalculateSuggestedMaxGuests(stats);
         _guestGenerationProbability = CalculateGuestGenerationProbability();
 
         WindowInvalidateByClass(WindowClass::Finances);
@@ -364,6 +366,12 @@ uint32_t Park::CalculateParkSize() const
 }
 
 int32_t Park::CalculateParkRating() const
+{
+    return CalculateParkRating(
+        GatherParkStatistics(EnumsToFlags(ParkStatisticsPart::Guests, ParkStatisticsPart::Rides, ParkStatisticsPart::Litter)));
+}
+
+int32_t Park::CalculateParkRating(const ParkStatistics& stats) const
 {
     if (_forcedParkRating >= 0)
     {
@@ -381,66 +389,34 @@ int32_t Park::CalculateParkRating() const
         // -150 to +3 based on a range of guests from 0 to 2000
         result -= 150 - (std::min<int32_t>(2000, gNumGuestsInPark) / 13);
 
-        // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>())
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
-
         // Peep happiness -500 to +0
         result -= 500;
         if (gNumGuestsInPark > 0)
         {
-            result += 2 * std::min(250u, (happyGuestCount * 300) / gNumGuestsInPark);
+            result += 2 * std::min(250u, (stats.HappyGuests * 300) / gNumGuestsInPark);
         }
 
         // Up to 25 guests can be lost without affecting the park rating.
-        if (lostGuestCount > 25)
+        if (stats.LostGuests > 25)
         {
-            result -= (lostGuestCount - 25) * 7;
+            result -= (stats.LostGuests - 25) * 7;
         }
     }
 
     // Rides
     {
-        int32_t rideCount = 0;
-        int32_t excitingRideCount = 0;
-        int32_t totalRideUptime = 0;
-        int32_t totalRideIntensity = 0;
-        int32_t totalRideExcitement = 0;
-        for (auto& ride : GetRideManager())
-        {
-            totalRideUptime += 100 - ride.downtime;
-            if (RideHasRatings(ride))
-            {
-                totalRideExcitement += ride.excitement / 8;
-                totalRideIntensity += ride.intensity / 8;
-                excitingRideCount++;
-            }
-            rideCount++;
-        }
+        int32_t totalRideIntensity = stats.TotalRideIntensity;
+        int32_t totalRideExcitement = stats.TotalRideExcitement;
         result -= 200;
-        if (rideCount > 0)
+        if (stats.Rides > 0)
         {
-            result += (totalRideUptime / rideCount) * 2;
+            result += (stats.TotalRideUptime / stats.Rides) * 2;
         }
         result -= 100;
-        if (excitingRideCount > 0)
+        if (stats.RatedRides > 0)
         {
-            int32_t averageExcitement = totalRideExcitement / excitingRideCount;
-            int32_t averageIntensity = totalRideIntensity / excitingRideCount;
+            int32_t averageExcitement = totalRideExcitement / stats.RatedRides;
+            int32_t averageIntensity = totalRideIntensity / stats.RatedRides;
 
             averageExcitement -= 46;
             if (averageExcitement < 0)
@@ -467,11 +443,7 @@ int32_t Park::CalculateParkRating() const
     // Litter
     {
         // Counts the amount of litter whose age is min. 7680 ticks (5~ min) old.
-        const auto litterList = EntityList<Litter>();
-        const auto litterCount = std::count_if(
-            litterList.begin(), litterList.end(), [](auto* litter) { return litter->GetAge() >= 7680; });
-
-        result -= 600 - (4 * (150 - std::min<int32_t>(150, litterCount)));
+        result -= 600 - (4 * (150 - std::min<int32_t>(150, stats.OldLitter)));
     }
 
     result -= gParkRatingCasualtyPenalty;
@@ -480,13 +452,14 @@ int32_t Park::CalculateParkRating() const
 }
 
 money64 Park::CalculateParkValue() const
+{
+    return CalculateParkValue(GatherParkStatistics(EnumToFlag(ParkStatisticsPart::RideValues)));
+}
+
+money64 Park::CalculateParkValue(const ParkStatistics& stats) const
 {
     // Sum ride values
-    money64 result = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        result += CalculateRideValue(ride);
-    }
+    money64 result = stats.TotalRideValue;
 
     // +7.00 per guest
     result += static_cast<money64>(gNumGuestsInPark) * 7.00_GBP;
@@ -494,17 +467,6 @@ money64 Park::CalculateParkValue() const
     return result;
 }
 
-money64 Park::CalculateRideValue(const Ride& ride) const
-{
-    money64 result = 0;
-    if (ride.value != RIDE_VALUE_UNDEFINED)
-    {
-        const auto& rtd = ride.GetRideTypeDescriptor();
-        result = (ride.value * 10) * (static_cast<money64>(RideCustomersInLast5Minutes(ride)) + rtd.BonusValue * 4LL);
-    }
-    return result;
-}
-
 money64 Park::CalculateCompanyValue() const
 {
     auto result = gParkValue - gBankLoan;
@@ -515,76 +477,13 @@ money64 Park::CalculateCompanyValue() const
     return result;
 }
 
-money64 Park::CalculateTotalRideValueForMoney() const
+uint32_t Park::CalculateSuggestedMaxGuests(const ParkStatistics& stats) const
 {
-    money64 totalRideValue = 0;
-    bool ridePricesUnlocked = ParkRidePricesUnlocked() && !(gParkFlags & PARK_FLAGS_NO_MONEY);
-    for (auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-            continue;
-
-        // Add ride value
-        if (ride.value != RIDE_VALUE_UNDEFINED)
-        {
-            money64 rideValue = ride.value;
-            if (ridePricesUnlocked)
-            {
-                rideValue -= ride.price[0];
-            }
-            if (rideValue > 0)
-            {
-                totalRideValue += rideValue * 2;
-            }
-        }
-    }
-    return totalRideValue;
-}
-
-uint32_t Park::CalculateSuggestedMaxGuests() const
-{
-    uint32_t suggestedMaxGuests = 0;
-    uint32_t difficultGenerationBonus = 0;
-
-    for (auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-            continue;
-
-        // Add guest score for ride type
-        suggestedMaxGuests += ride.GetRideTypeDescriptor().BonusValue;
-
-        // If difficult guest generation, extra guests are available for good rides
-        if (gParkFlags & PARK_FLAGS_DIFFICULT_GUEST_GENERATION)
-        {
-            if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-                continue;
-            if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
-                continue;
-            if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_DATA_LOGGING))
-                continue;
-            if (ride.GetStation().SegmentLength < (600 << 16))
-                continue;
-            if (ride.excitement < RIDE_RATING(6, 00))
-                continue;
-
-            // Bonus guests for good ride
-            difficultGenerationBonus += ride.GetRideTypeDescriptor().BonusValue * 2;
-        }
-    }
-
+    uint32_t suggestedMaxGuests = stats.SuggestedMaxGuests;
     if (gParkFlags & PARK_FLAGS_DIFFICULT_GUEST_GENERATION)
     {
         suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 1000);
-        suggestedMaxGuests += difficultGenerationBonus;
+        suggestedMaxGuests += stats.DifficultGenerationBonus;
     }
 
     suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 65535);
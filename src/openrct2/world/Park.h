@@ -51,6 +51,7 @@ struct rct_ride;
 namespace OpenRCT2
 {
     class Date;
+    struct ParkStatistics;
 
     class Park final
     {
@@ -72,7 +73,9 @@ namespace OpenRCT2
 
         uint32_t CalculateParkSize() const;
         int32_t CalculateParkRating() const;
+        int32_t CalculateParkRating(const ParkStatistics& stats) const;
         money64 CalculateParkValue() const;
+        money64 CalculateParkValue(const ParkStatistics& stats) const;
         money64 CalculateCompanyValue() const;
         static uint8_t CalculateGuestInitialHappiness(uint8_t percentage);
 
@@ -82,9 +85,7 @@ namespace OpenRCT2
         void UpdateHistories();
 
     private:
-        money64 CalculateRideValue(const Ride& ride) const;
-        money64 CalculateTotalRideValueForMoney() const;
-        uint32_t CalculateSuggestedMaxGuests() const;
+        uint32_t CalculateSuggestedMaxGuests(const ParkStatistics& stats) const;
         uint32_t CalculateGuestGenerationProbability() const;
 
         void GenerateGuests();
@@ -0,0 +1,209 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkStatistics.h"
+
+#include "../entity/EntityList.h"
+#include "../entity/Guest.h"
+#include "../entity/Litter.h"
+#include "../interface/Colour.h"
+#include "../ride/Ride.h"
+#include "../ride/RideData.h"
+#include "Park.h"
+
+#include <algorithm>
+
+using namespace OpenRCT2;
+
+static constexpr colour_t DazzlingRideColours[] = {
+    COLOUR_BRIGHT_PURPLE,
+    COLOUR_BRIGHT_GREEN,
+    COLOUR_LIGHT_ORANGE,
+    COLOUR_BRIGHT_PINK,
+};
+
+static void GatherGuestStatistics(ParkStatistics& stats)
+{
+    for (auto* guest : EntityList<Guest>())
+    {
+        if (guest->OutsideOfPark)
+            continue;
+
+        stats.Guests++;
+        if (guest->Happiness > 128)
+        {
+            stats.HappyGuests++;
+        }
+        if ((guest->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (guest->GuestIsLostCountdown < 90))
+        {
+            stats.LostGuests++;
+        }
+
+        const auto& thought = std::get<0>(guest->Thoughts);
+        if (thought.freshness <= 5)
+        {
+            stats.FreshThoughts[EnumValue(thought.type)]++;
+        }
+    }
+}
+
+static money64 CalculateRideValue(const Ride& ride)
+{
+    money64 result = 0;
+    if (ride.value != RIDE_VALUE_UNDEFINED)
+    {
+        const auto& rtd = ride.GetRideTypeDescriptor();
+        result = (ride.value * 10) * (static_cast<money64>(RideCustomersInLast5Minutes(ride)) + rtd.BonusValue * 4LL);
+    }
+    return result;
+}
+
+static bool IsRideGoodForDifficultGuestGeneration(const Ride& ride)
+{
+    const auto& rtd = ride.GetRideTypeDescriptor();
+    return (ride.lifecycle_flags & RIDE_LIFECYCLE_TESTED) && rtd.HasFlag(RIDE_TYPE_FLAG_HAS_TRACK)
+        && rtd.HasFlag(RIDE_TYPE_FLAG_HAS_DATA_LOGGING) && ride.GetStation().SegmentLength >= (600 << 16)
+        && ride.excitement >= RIDE_RATING(6, 00);
+}
+
+static void GatherRideStatistics(ParkStatistics& stats, bool includeRideValues)
+{
+    const bool ridePricesUnlocked = ParkRidePricesUnlocked() && !(gParkFlags & PARK_FLAGS_NO_MONEY);
+    const bool difficultGuestGeneration = (gParkFlags & PARK_FLAGS_DIFFICULT_GUEST_GENERATION) != 0;
+    uint64_t foodShopTypes = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        const auto& rtd = ride.GetRideTypeDescriptor();
+        const bool isOpen = ride.status == RideStatus::Open;
+        const bool isCrashed = (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED) != 0;
+        const bool isBrokenDown = (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN) != 0;
+
+        // Park rating
+        stats.Rides++;
+        stats.TotalRideUptime += 100 - ride.downtime;
+        if (RideHasRatings(ride))
+        {
+            stats.TotalRideExcitement += ride.excitement / 8;
+            stats.TotalRideIntensity += ride.intensity / 8;
+            stats.RatedRides++;
+        }
+        if (ride.last_crash_type != RIDE_CRASH_TYPE_NONE)
+        {
+            stats.AnyRideCrashed = true;
+        }
+
+        // Park value and guest generation
+        if (includeRideValues)
+        {
+            stats.TotalRideValue += CalculateRideValue(ride);
+        }
+        if (isOpen && !isBrokenDown && !isCrashed)
+        {
+            if (ride.value != RIDE_VALUE_UNDEFINED)
+            {
+                money64 rideValue = ride.value;
+                if (ridePricesUnlocked)
+                {
+                    rideValue -= ride.price[0];
+                }
+                if (rideValue > 0)
+                {
+                    stats.TotalRideValueForMoney += rideValue * 2;
+                }
+            }
+
+            stats.SuggestedMaxGuests += rtd.BonusValue;
+            if (difficultGuestGeneration && IsRideGoodForDifficultGuestGeneration(ride))
+            {
+                stats.DifficultGenerationBonus += rtd.BonusValue * 2;
+            }
+        }
+
+        // Awards
+        const auto* rideEntry = ride.GetRideEntry();
+        if (rideEntry != nullptr && isOpen && !isCrashed)
+        {
+            if (RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_ROLLERCOASTER))
+                stats.RollerCoasters++;
+            if (RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_WATER))
+                stats.WaterRides++;
+            if (RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_GENTLE))
+                stats.GentleRides++;
+        }
+        if (isOpen && rtd.HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
+        {
+            stats.FoodShops++;
+            if (rideEntry != nullptr && !(foodShopTypes & EnumToFlag(rideEntry->shop_item[0])))
+            {
+                foodShopTypes |= EnumToFlag(rideEntry->shop_item[0]);
+                stats.UniqueFoodShops++;
+            }
+        }
+        if (isOpen && rtd.HasFlag(RIDE_TYPE_FLAG_IS_TOILET))
+        {
+            stats.Toilets++;
+        }
+        if (RideHasRatings(ride) && ride.popularity != 0xFF)
+        {
+            stats.RidesWithPopularity++;
+            if (ride.popularity <= 6)
+            {
+                stats.DisappointingRides++;
+            }
+        }
+        if (rtd.HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
+        {
+            if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_NOT_CUSTOM_DESIGN) && ride.excitement >= RIDE_RATING(5, 50) && isOpen
+                && !isCrashed)
+            {
+                stats.CustomDesignedRides++;
+            }
+
+            stats.TrackedRides++;
+            const auto mainTrackColour = ride.track_colour[0].main;
+            if (std::find(std::begin(DazzlingRideColours), std::end(DazzlingRideColours), mainTrackColour)
+                != std::end(DazzlingRideColours))
+            {
+                stats.ColourfulRides++;
+            }
+        }
+    }
+}
+
+static void GatherLitterStatistics(ParkStatistics& stats)
+{
+    for (auto* litter : EntityList<Litter>())
+    {
+        if (litter->GetAge() >= 7680)
+        {
+            stats.OldLitter++;
+        }
+    }
+}
+
+namespace OpenRCT2
+{
+    ParkStatistics GatherParkStatistics(uint64_t parts)
+    {
+        ParkStatistics stats;
+        if (parts & EnumToFlag(ParkStatisticsPart::Guests))
+        {
+            GatherGuestStatistics(stats);
+        }
+        if (parts & EnumsToFlags(ParkStatisticsPart::Rides, ParkStatisticsPart::RideValues))
+        {
+            GatherRideStatistics(stats, (parts & EnumToFlag(ParkStatisticsPart::RideValues)) != 0);
+        }
+        if (parts & EnumToFlag(ParkStatisticsPart::Litter))
+        {
+            GatherLitterStatistics(stats);
+        }
+        return stats;
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,91 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../util/Util.h"
+
+#include <array>
+
+enum class PeepThoughtType : uint8_t;
+
+namespace OpenRCT2
+{
+    /**
+     * Parts of the park statistics that can be gathered on their own, the fields of the other parts are left at zero.
+     */
+    enum class ParkStatisticsPart : uint8_t
+    {
+        Guests,
+        Rides,
+        // The total ride value, it needs the recent customers of every ride.
+        RideValues,
+        Litter,
+    };
+
+    constexpr uint64_t AllParkStatisticsParts = EnumsToFlags(
+        ParkStatisticsPart::Guests, ParkStatisticsPart::Rides, ParkStatisticsPart::RideValues, ParkStatisticsPart::Litter);
+
+    /**
+     * Totals over the guests, rides and litter of the park, gathered in a single pass over each of them. The totals
+     * are not maintained incrementally: guest and ride fields are written directly from too many places for that to
+     * stay correct. Every call walks the guests, rides and litter of the requested parts again, so there is no cached
+     * state that could drift from a full recompute.
+     */
+    struct ParkStatistics
+    {
+        // Guests inside the park
+        uint32_t Guests{};
+        uint32_t HappyGuests{};
+        uint32_t LostGuests{};
+        // Guests inside the park whose newest thought is fresh, by thought type
+        std::array<uint32_t, 256> FreshThoughts{};
+
+        int32_t Rides{};
+        int32_t RatedRides{};
+        int32_t TotalRideUptime{};
+        int32_t TotalRideExcitement{};
+        int32_t TotalRideIntensity{};
+        // Only gathered with ParkStatisticsPart::RideValues
+        money64 TotalRideValue{};
+        money64 TotalRideValueForMoney{};
+        uint32_t SuggestedMaxGuests{};
+        uint32_t DifficultGenerationBonus{};
+        bool AnyRideCrashed{};
+
+        // Open rides that have not crashed, by category of their ride entry
+        uint32_t RollerCoasters{};
+        uint32_t WaterRides{};
+        uint32_t GentleRides{};
+        uint32_t CustomDesignedRides{};
+
+        uint32_t FoodShops{};
+        uint32_t UniqueFoodShops{};
+        uint32_t Toilets{};
+
+        // Rides with ratings and a known popularity, and those of them with a popularity of 6 or less
+        uint32_t RidesWithPopularity{};
+        uint32_t DisappointingRides{};
+
+        // Rides with track, and those of them with a dazzling main track colour
+        uint32_t TrackedRides{};
+        uint32_t ColourfulRides{};
+
+        // Litter that has been lying around for about 5 minutes or more
+        uint32_t OldLitter{};
+
+        uint32_t GetFreshThoughtCount(PeepThoughtType type) const
+        {
+            return FreshThoughts[EnumValue(type)];
+        }
+    };
+
+    ParkStatistics GatherParkStatistics(uint64_t parts = AllParkStatisticsParts);
+} // namespace OpenRCT2
@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Location.hpp"
+#include "TileElement.h"
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Keeps track of which element types are present on each tile, so that lookups for a type can skip
+ * tiles without walking their elements. Removing an element does not clear its type, a set type only
+ * means the tile may contain it until the tile is updated or the index is rebuilt.
+ */
+class TileElementTypeIndex
+{
+    std::vector<uint8_t> TileTypes;
+    uint16_t MapSize{};
+
+    static constexpr uint8_t GetTypeMask(TileElementType type)
+    {
+        return 1u << static_cast<uint8_t>(type);
+    }
+
+public:
+    TileElementTypeIndex() = default;
+
+    explicit TileElementTypeIndex(const uint16_t mapSize, const TileElement* tileElements, size_t count)
+    {
+        MapSize = mapSize;
+        TileTypes.reserve(MapSize * MapSize);
+
+        size_t index = 0;
+        for (size_t y = 0; y < MapSize; y++)
+        {
+            for (size_t x = 0; x < MapSize; x++)
+            {
+                assert(index < count);
+                uint8_t types = 0;
+                do
+                {
+                    types |= GetTypeMask(tileElements[index].GetType());
+                    index++;
+                } while (!tileElements[index - 1].IsLastForTile());
+                TileTypes.push_back(types);
+            }
+        }
+    }
+
+    bool HasType(TileCoordsXY coords, TileElementType type) const
+    {
+        return (TileTypes[coords.x + (coords.y * MapSize)] & GetTypeMask(type)) != 0;
+    }
+
+    void AddType(TileCoordsXY coords, TileElementType type)
+    {
+        TileTypes[coords.x + (coords.y * MapSize)] |= GetTypeMask(type);
+    }
+
+    void SetTile(TileCoordsXY coords, const TileElement* tileElement)
+    {
+        uint8_t types = 0;
+        if (tileElement != nullptr)
+        {
+            do
+            {
+                types |= GetTypeMask(tileElement->GetType());
+            } while (!(tileElement++)->IsLastForTile());
+        }
+        TileTypes[coords.x + (coords.y * MapSize)] = types;
+    }
+};
@@ -116,6 +116,14 @@ namespace OpenRCT2
 
         Iterator begin() noexcept
         {
+            if constexpr (!std::is_same_v<T, TileElement>)
+            {
+                if (!MapTileHasElementType(_loc, T::ElementType))
+                {
+                    return end();
+                }
+            }
+
             T* element = reinterpret_cast<T*>(MapGetFirstElementAt(_loc));
 
             if constexpr (!std::is_same_v<T, TileElement>)
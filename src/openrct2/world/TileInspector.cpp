@@ -340,6 +340,7 @@ namespace OpenRCT2::TileInspector
             bool lastForTile = pastedElement->IsLastForTile();
             *pastedElement = element;
             pastedElement->SetLastForTile(lastForTile);
+            MapUpdateTileElementTypes(tileLoc);
 
             MapAnimationAutoCreateAtTileElement(tileLoc, pastedElement);
 
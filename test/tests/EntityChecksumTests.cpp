@@ -0,0 +1,78 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include <gtest/gtest.h>
+#    include <openrct2/entity/EntityList.h>
+#    include <openrct2/entity/EntityRegistry.h>
+#    include <openrct2/entity/Guest.h>
+
+class EntityChecksumTests : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ResetAllEntities();
+    }
+
+    void TearDown() override
+    {
+        ResetAllEntities();
+    }
+
+    static void CreateGuests()
+    {
+        for (int32_t i = 0; i < 64; i++)
+        {
+            auto* guest = CreateEntity<Guest>();
+            ASSERT_NE(guest, nullptr);
+            guest->Happiness = static_cast<uint8_t>(i * 3);
+            guest->PreviousRide = RideId::FromUnderlying(i);
+            guest->PreviousRideTimeOut = static_cast<uint16_t>(i * 10);
+            guest->Thoughts[0].type = PeepThoughtType::Hungry;
+            guest->Thoughts[0].freshness = static_cast<uint8_t>(i);
+        }
+    }
+};
+
+TEST_F(EntityChecksumTests, SameStateGivesSameChecksum)
+{
+    CreateGuests();
+    const auto first = GetAllEntitiesChecksum();
+    ASSERT_EQ(GetAllEntitiesChecksum().raw, first.raw);
+
+    ResetAllEntities();
+    CreateGuests();
+    ASSERT_EQ(GetAllEntitiesChecksum().raw, first.raw);
+    ASSERT_EQ(GetAllEntitiesChecksumFull().raw, first.raw);
+}
+
+TEST_F(EntityChecksumTests, ChangedGuestChangesChecksum)
+{
+    CreateGuests();
+    const auto before = GetAllEntitiesChecksum();
+
+    auto* guest = *EntityList<Guest>().begin();
+    guest->PreviousRideTimeOut++;
+    const auto afterTimeOut = GetAllEntitiesChecksum();
+    ASSERT_NE(afterTimeOut.raw, before.raw);
+    ASSERT_EQ(GetAllEntitiesChecksumFull().raw, afterTimeOut.raw);
+
+    guest->PreviousRideTimeOut--;
+    guest->Thoughts[0].freshness++;
+    const auto afterThought = GetAllEntitiesChecksum();
+    ASSERT_NE(afterThought.raw, before.raw);
+    ASSERT_EQ(GetAllEntitiesChecksumFull().raw, afterThought.raw);
+
+    guest->Thoughts[0].freshness--;
+    ASSERT_EQ(GetAllEntitiesChecksum().raw, before.raw);
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,136 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/entity/EntityIdSet.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Guest.h>
+#include <random>
+#include <set>
+#include <vector>
+
+class EntityIdSetTests : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ResetAllEntities();
+    }
+
+    void TearDown() override
+    {
+        ResetAllEntities();
+    }
+
+    static std::vector<EntityId> ToVector(const EntityIdSet& set)
+    {
+        return std::vector<EntityId>(set.begin(), set.end());
+    }
+};
+
+TEST_F(EntityIdSetTests, MatchesSortedSet)
+{
+    std::mt19937 random(1234);
+    EntityIdSet set;
+    std::set<EntityId> expected;
+    for (int32_t i = 0; i < 20000; i++)
+    {
+        // Mostly low ids, with some spread over the whole range to leave empty blocks in between.
+        const auto index = i % 4 == 0 ? random() % 65535 : random() % 2000;
+        const auto id = EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(index));
+        if (random() % 3 == 0)
+        {
+            set.Remove(id);
+            expected.erase(id);
+        }
+        else
+        {
+            set.Insert(id);
+            expected.insert(id);
+        }
+        ASSERT_EQ(set.Contains(id), expected.count(id) != 0);
+    }
+
+    ASSERT_EQ(set.size(), expected.size());
+    ASSERT_EQ(ToVector(set), std::vector<EntityId>(expected.begin(), expected.end()));
+
+    set.clear();
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST_F(EntityIdSetTests, BlockBoundaries)
+{
+    EntityIdSet set;
+    std::vector<EntityId> ids;
+    for (auto index : { 0, 63, 64, 4095, 4096, 4097, 65534 })
+    {
+        ids.push_back(EntityId::FromUnderlying(index));
+        set.Insert(ids.back());
+    }
+    ASSERT_EQ(ToVector(set), ids);
+
+    set.Remove(EntityId::FromUnderlying(4096));
+    set.Remove(EntityId::FromUnderlying(4096));
+    ids.erase(ids.begin() + 4);
+    ASSERT_EQ(set.size(), ids.size());
+    ASSERT_EQ(ToVector(set), ids);
+}
+
+TEST_F(EntityIdSetTests, ModifyWhileIterating)
+{
+    EntityIdSet set;
+    for (auto index : { 10, 20, 30 })
+    {
+        set.Insert(EntityId::FromUnderlying(index));
+    }
+
+    // Like a sorted list, ids inserted after the next id to visit are visited, removed ids are not.
+    std::vector<EntityId> visited;
+    for (auto it = set.begin(); it != set.end();)
+    {
+        const auto id = *it++;
+        visited.push_back(id);
+        if (id == EntityId::FromUnderlying(10))
+        {
+            set.Remove(id);
+            set.Insert(EntityId::FromUnderlying(25));
+            set.Remove(EntityId::FromUnderlying(30));
+            set.Insert(EntityId::FromUnderlying(40));
+        }
+    }
+    const std::vector<EntityId> expected = { EntityId::FromUnderlying(10), EntityId::FromUnderlying(20),
+                                             EntityId::FromUnderlying(25), EntityId::FromUnderlying(40) };
+    ASSERT_EQ(visited, expected);
+}
+
+TEST_F(EntityIdSetTests, IteratesInIdOrder)
+{
+    std::vector<Guest*> guests;
+    for (int32_t i = 0; i < 100; i++)
+    {
+        guests.push_back(CreateEntity<Guest>());
+        ASSERT_NE(guests.back(), nullptr);
+    }
+    for (size_t i = 0; i < guests.size(); i += 3)
+    {
+        EntityRemove(guests[i]);
+    }
+
+    std::vector<EntityId> ids;
+    for (auto* guest : EntityList<Guest>())
+    {
+        ids.push_back(guest->Id);
+    }
+    ASSERT_EQ(ids.size(), GetEntityListCount(EntityType::Guest));
+    ASSERT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    ASSERT_EQ(ids, ToVector(GetEntityList(EntityType::Guest)));
+}
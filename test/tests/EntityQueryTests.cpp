@@ -0,0 +1,151 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <limits>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Litter.h>
+#include <random>
+#include <vector>
+
+class EntityQueryTests : public testing::Test
+{
+protected:
+    std::mt19937 _random{ 1234 };
+
+    void SetUp() override
+    {
+        ResetAllEntities();
+    }
+
+    void TearDown() override
+    {
+        ResetAllEntities();
+    }
+
+    int32_t RandomCoord(int32_t min, int32_t max)
+    {
+        return std::uniform_int_distribution<int32_t>(min, max)(_random);
+    }
+
+    void CreateLitter(int32_t count, int32_t mapSize)
+    {
+        for (int32_t i = 0; i < count; i++)
+        {
+            auto* litter = CreateEntity<Litter>();
+            ASSERT_NE(litter, nullptr);
+            litter->MoveTo({ RandomCoord(0, mapSize - 1), RandomCoord(0, mapSize - 1), RandomCoord(0, 64) * 8 });
+        }
+    }
+
+    static int32_t GetDistance(const Litter* litter, const CoordsXYZ& loc)
+    {
+        return std::abs(litter->x - loc.x) + std::abs(litter->y - loc.y) + std::abs(litter->z - loc.z) * 4;
+    }
+
+    // What GetNearestEntities returns, found by checking every entity.
+    static std::vector<Litter*> GetNearestLinear(const CoordsXYZ& loc, size_t count, int32_t maxDistance)
+    {
+        std::vector<Litter*> result;
+        for (auto* litter : EntityList<Litter>())
+        {
+            if (litter->Id.ToUnderlying() % 3 != 0 && GetDistance(litter, loc) <= maxDistance)
+            {
+                result.push_back(litter);
+            }
+        }
+        std::stable_sort(result.begin(), result.end(), [&loc](const Litter* a, const Litter* b) {
+            return GetDistance(a, loc) < GetDistance(b, loc);
+        });
+        result.resize(std::min(result.size(), count));
+        return result;
+    }
+};
+
+TEST_F(EntityQueryTests, RangeMatchesLinearScan)
+{
+    CreateLitter(3000, 64 * COORDS_XY_STEP);
+    for (int32_t i = 0; i < 200; i++)
+    {
+        const auto left = RandomCoord(-200, 64 * COORDS_XY_STEP);
+        const auto top = RandomCoord(-200, 64 * COORDS_XY_STEP);
+        const MapRange range(left, top, left + RandomCoord(0, 300), top + RandomCoord(0, 300));
+
+        std::vector<Litter*> expected;
+        for (auto* litter : EntityList<Litter>())
+        {
+            if (litter->x >= range.GetLeft() && litter->x <= range.GetRight() && litter->y >= range.GetTop()
+                && litter->y <= range.GetBottom())
+            {
+                expected.push_back(litter);
+            }
+        }
+        ASSERT_EQ(GetEntitiesInRange<Litter>(range), expected);
+    }
+}
+
+TEST_F(EntityQueryTests, RadiusMatchesLinearScan)
+{
+    CreateLitter(3000, 64 * COORDS_XY_STEP);
+    for (int32_t i = 0; i < 200; i++)
+    {
+        const CoordsXY loc{ RandomCoord(-100, 64 * COORDS_XY_STEP), RandomCoord(-100, 64 * COORDS_XY_STEP) };
+        const auto radius = RandomCoord(0, 200);
+
+        std::vector<Litter*> expected;
+        for (auto* litter : EntityList<Litter>())
+        {
+            const auto dx = litter->x - loc.x;
+            const auto dy = litter->y - loc.y;
+            if (dx * dx + dy * dy <= radius * radius)
+            {
+                expected.push_back(litter);
+            }
+        }
+        ASSERT_EQ(GetEntitiesInRadius<Litter>(loc, radius), expected);
+    }
+}
+
+TEST_F(EntityQueryTests, NearestMatchesLinearScan)
+{
+    // Few entities spread over a large map make the search fall back to the entity list, many make it walk the tiles.
+    for (const auto numLitter : { 20, 4000 })
+    {
+        ResetAllEntities();
+        CreateLitter(numLitter, 128 * COORDS_XY_STEP);
+        for (int32_t i = 0; i < 200; i++)
+        {
+            const CoordsXYZ loc{ RandomCoord(0, 128 * COORDS_XY_STEP - 1), RandomCoord(0, 128 * COORDS_XY_STEP - 1),
+                                 RandomCoord(0, 64) * 8 };
+            const size_t count = RandomCoord(1, 5);
+            const auto maxDistance = i % 2 == 0 ? RandomCoord(0, 400) : std::numeric_limits<int32_t>::max();
+
+            auto actual = GetNearestEntities<Litter>(
+                loc, count, maxDistance, [&loc](const Litter* litter) { return GetDistance(litter, loc); },
+                [](const Litter* litter) { return litter->Id.ToUnderlying() % 3 != 0; });
+            ASSERT_EQ(actual, GetNearestLinear(loc, count, maxDistance))
+                << numLitter << " litter, at " << loc.x << ", " << loc.y << ", " << loc.z;
+        }
+    }
+}
+
+TEST_F(EntityQueryTests, SkipsEntitiesWithoutLocation)
+{
+    auto* litter = CreateEntity<Litter>();
+    ASSERT_NE(litter, nullptr);
+    const auto getDistance = [](const Litter* entity) { return entity->x + entity->y; };
+    ASSERT_EQ(GetNearestEntity<Litter>({ 0, 0 }, std::numeric_limits<int32_t>::max(), getDistance), nullptr);
+
+    litter->MoveTo({ 48, 48, 0 });
+    ASSERT_EQ(GetNearestEntity<Litter>({ 0, 0 }, std::numeric_limits<int32_t>::max(), getDistance), litter);
+    ASSERT_EQ(GetEntitiesInRange<Litter>({ -100, -100, 0, 0 }).size(), 0u);
+}
@@ -0,0 +1,142 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+#include <openrct2/GameStateSnapshots.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Litter.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr uint32_t TestLitterCount = 10;
+static constexpr uint32_t TestTicks = 45;
+static constexpr uint32_t AddedTick = 20;
+static constexpr uint32_t RemovedTick = 30;
+
+static uint32_t GetExpectedCreationTick(uint32_t tick)
+{
+    return tick < TestLitterCount ? 0 : tick - TestLitterCount + 100;
+}
+
+static std::vector<GameStateSpriteChange> GetChanges(const GameStateCompareData& cmpData)
+{
+    std::vector<GameStateSpriteChange> changes;
+    for (const auto& change : cmpData.spriteChanges)
+    {
+        if (change.changeType != GameStateSpriteChange::EQUAL)
+        {
+            changes.push_back(change);
+        }
+    }
+    return changes;
+}
+
+class GameStateSnapshotsTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ResetAllEntities();
+        for (uint32_t i = 0; i < TestLitterCount; i++)
+        {
+            auto* litter = CreateEntity<Litter>();
+            ASSERT_NE(litter, nullptr);
+            litter->x = i * 32;
+            litter->y = 64;
+            litter->creationTick = 0;
+            _litter.push_back(litter);
+        }
+
+        // Change one entity every tick, add one and remove it again to change the size of the captured data.
+        Litter* added = nullptr;
+        for (uint32_t tick = 0; tick < TestTicks; tick++)
+        {
+            _litter[tick % TestLitterCount]->creationTick = tick + 100;
+            if (tick == AddedTick)
+            {
+                added = CreateEntity<Litter>();
+                ASSERT_NE(added, nullptr);
+                added->creationTick = 1;
+            }
+            else if (tick == RemovedTick)
+            {
+                EntityRemove(added);
+            }
+
+            auto& snapshot = _snapshots->CreateSnapshot();
+            _snapshots->Capture(snapshot);
+            _snapshots->LinkSnapshot(snapshot, tick, tick);
+        }
+    }
+
+    void TearDown() override
+    {
+        ResetAllEntities();
+    }
+
+    std::unique_ptr<IGameStateSnapshots> _snapshots = CreateGameStateSnapshots();
+    std::vector<Litter*> _litter;
+};
+
+TEST_F(GameStateSnapshotsTest, History)
+{
+    // Only the most recent snapshots are kept, deltas stay readable after their keyframe was removed.
+    const uint32_t firstTick = TestTicks - 32;
+    ASSERT_EQ(_snapshots->GetLinkedSnapshot(firstTick - 1), nullptr);
+    ASSERT_EQ(_snapshots->GetLinkedSnapshot(TestTicks), nullptr);
+
+    for (uint32_t tick = firstTick + 1; tick < TestTicks; tick++)
+    {
+        const auto* previous = _snapshots->GetLinkedSnapshot(tick - 1);
+        const auto* current = _snapshots->GetLinkedSnapshot(tick);
+        ASSERT_NE(previous, nullptr);
+        ASSERT_NE(current, nullptr);
+
+        const auto changes = GetChanges(_snapshots->Compare(*previous, *current));
+        const bool sizeChanged = tick == AddedTick || tick == RemovedTick;
+        ASSERT_EQ(changes.size(), sizeChanged ? 2u : 1u) << "tick " << tick;
+
+        const auto& litter = *_litter[tick % TestLitterCount];
+        for (const auto& change : changes)
+        {
+            if (change.spriteIndex != litter.Id.ToUnderlying())
+            {
+                ASSERT_EQ(change.changeType, tick == AddedTick ? GameStateSpriteChange::ADDED : GameStateSpriteChange::REMOVED);
+                continue;
+            }
+            ASSERT_EQ(change.changeType, GameStateSpriteChange::MODIFIED);
+            ASSERT_EQ(change.diffs.size(), 1u);
+            ASSERT_EQ(change.diffs[0].valueA, GetExpectedCreationTick(tick));
+            ASSERT_EQ(change.diffs[0].valueB, tick + 100);
+        }
+    }
+}
+
+TEST_F(GameStateSnapshotsTest, Serialise)
+{
+    // Snapshots are always sent with all entities.
+    for (uint32_t tick = TestTicks - 10; tick < TestTicks; tick++)
+    {
+        auto& snapshot = const_cast<GameStateSnapshot_t&>(*_snapshots->GetLinkedSnapshot(tick));
+        MemoryStream ms;
+        DataSerialiser saver(true, ms);
+        _snapshots->SerialiseSnapshot(snapshot, saver);
+
+        auto snapshots = CreateGameStateSnapshots();
+        auto& loaded = snapshots->CreateSnapshot();
+        ms.SetPosition(0);
+        DataSerialiser loader(false, ms);
+        snapshots->SerialiseSnapshot(loaded, loader);
+
+        const auto cmpData = _snapshots->Compare(snapshot, loaded);
+        ASSERT_EQ(cmpData.tickRight, tick);
+        ASSERT_TRUE(GetChanges(cmpData).empty());
+    }
+}
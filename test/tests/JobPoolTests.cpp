@@ -0,0 +1,108 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/core/JobPool.h>
+#include <vector>
+
+TEST(JobPoolTest, AddTaskAndJoin)
+{
+    JobPool jobPool;
+    std::atomic<size_t> counter = 0;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        jobPool.AddTask([&counter]() { counter++; });
+    }
+    jobPool.Join();
+    ASSERT_EQ(counter, 1000u);
+    ASSERT_EQ(jobPool.CountPending(), 0u);
+}
+
+TEST(JobPoolTest, JoinWithoutThreads)
+{
+    // Join executes the tasks itself when there are no workers.
+    JobPool jobPool(0);
+    size_t counter = 0;
+    jobPool.AddTask([&counter]() { counter++; });
+    jobPool.AddTask([&counter]() { counter++; });
+    jobPool.Join();
+    ASSERT_EQ(counter, 2u);
+}
+
+TEST(JobPoolTest, LargeTask)
+{
+    // Captures that do not fit the inline storage of a task are moved to the heap.
+    JobPool jobPool;
+    std::array<size_t, 64> values{};
+    values.fill(1);
+    std::atomic<size_t> sum = 0;
+    jobPool.AddTask([values, &sum]() {
+        for (auto value : values)
+        {
+            sum += value;
+        }
+    });
+    jobPool.AddTask([ptr = std::make_unique<size_t>(5), &sum]() { sum += *ptr; });
+    jobPool.Join();
+    ASSERT_EQ(sum, 69u);
+}
+
+TEST(JobPoolTest, ParallelFor)
+{
+    JobPool jobPool;
+    std::vector<size_t> results(10000);
+    jobPool.ParallelFor(results.size(), [&results](size_t i) { results[i] = i * 2; });
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        ASSERT_EQ(results[i], i * 2);
+    }
+}
+
+TEST(JobPoolTest, ParallelForRange)
+{
+    JobPool jobPool;
+    std::vector<uint8_t> visited(1234);
+    std::atomic<size_t> ranges = 0;
+    jobPool.ParallelForRange(visited.size(), 100, [&](size_t begin, size_t end) {
+        ASSERT_LT(begin, end);
+        ASSERT_TRUE(end - begin >= 100 || end == visited.size());
+        for (size_t i = begin; i < end; i++)
+        {
+            visited[i]++;
+        }
+        ranges++;
+    });
+    for (auto count : visited)
+    {
+        ASSERT_EQ(count, 1);
+    }
+    ASSERT_LE(ranges, 13u);
+}
+
+TEST(JobPoolTest, JoinWaitsForNestedTasks)
+{
+    // Tasks queued by other tasks while Join is waiting must also complete before it returns.
+    JobPool jobPool(2);
+    std::atomic<size_t> counter = 0;
+    for (size_t i = 0; i < 10; i++)
+    {
+        jobPool.AddTask([&jobPool, &counter]() {
+            for (size_t j = 0; j < 10; j++)
+            {
+                jobPool.AddTask([&counter]() { counter++; });
+            }
+            counter++;
+        });
+    }
+    jobPool.Join();
+    ASSERT_EQ(counter, 110u);
+    ASSERT_EQ(jobPool.CountPending(), 0u);
+}
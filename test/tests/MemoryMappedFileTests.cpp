@@ -0,0 +1,48 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/IStream.hpp>
+#include <openrct2/core/MemoryMappedFile.h>
+#include <openrct2/core/Path.hpp>
+#include <vector>
+
+using namespace OpenRCT2;
+
+TEST(MemoryMappedFileTests, MatchesFileContents)
+{
+    auto path = Path::Combine(TestData::GetBasePath(), u8"images", u8"logo.png");
+    auto expected = File::ReadAllBytes(path);
+    ASSERT_FALSE(expected.empty());
+
+    MemoryMappedFile file(path);
+    ASSERT_EQ(file.GetLength(), expected.size());
+    ASSERT_EQ(std::vector<uint8_t>(file.GetData(), file.GetData() + file.GetLength()), expected);
+}
+
+TEST(MemoryMappedFileTests, WritesStayPrivate)
+{
+    auto path = Path::Combine(TestData::GetBasePath(), u8"images", u8"logo.png");
+    auto expected = File::ReadAllBytes(path);
+    {
+        MemoryMappedFile file(path);
+        file.GetData()[0] ^= 0xFF;
+        ASSERT_NE(file.GetData()[0], expected[0]);
+    }
+    ASSERT_EQ(File::ReadAllBytes(path), expected);
+}
+
+TEST(MemoryMappedFileTests, MissingFileThrows)
+{
+    auto path = Path::Combine(TestData::GetBasePath(), u8"images", u8"missing.png");
+    ASSERT_THROW(MemoryMappedFile file(path), IOException);
+}
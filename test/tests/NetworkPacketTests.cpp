@@ -0,0 +1,182 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include <algorithm>
+#    include <chrono>
+#    include <gtest/gtest.h>
+#    include <memory>
+#    include <openrct2/network/NetworkConnection.h>
+#    include <openrct2/network/NetworkPacket.h>
+#    include <openrct2/network/Socket.h>
+#    include <string>
+#    include <thread>
+#    include <utility>
+#    include <vector>
+
+static NetworkPacket CreateTestPacket(uint32_t value)
+{
+    NetworkPacket packet(NetworkCommand::Tick);
+    packet << value << value * 3;
+    packet.WriteString("tick " + std::to_string(value));
+    return packet;
+}
+
+static void AssertTestPacket(NetworkPacket& packet, uint32_t value)
+{
+    // The size is only set when a packet is queued or received.
+    packet.Header.Size = static_cast<uint16_t>(packet.GetSize());
+
+    uint32_t first{};
+    uint32_t second{};
+    packet >> first >> second;
+    ASSERT_EQ(packet.GetCommand(), NetworkCommand::Tick);
+    ASSERT_EQ(first, value);
+    ASSERT_EQ(second, value * 3);
+    ASSERT_EQ(packet.ReadString(), "tick " + std::to_string(value));
+}
+
+TEST(NetworkPacketTest, CopiesShareData)
+{
+    auto packet = CreateTestPacket(5);
+    auto copy = packet;
+    ASSERT_EQ(std::as_const(copy).GetData(), std::as_const(packet).GetData());
+
+    // Writing to a copy leaves the other packets as they are.
+    copy << uint32_t{ 7 };
+    ASSERT_NE(std::as_const(copy).GetData(), std::as_const(packet).GetData());
+    ASSERT_EQ(copy.GetSize(), packet.GetSize() + sizeof(uint32_t));
+    AssertTestPacket(packet, 5);
+    AssertTestPacket(copy, 5);
+}
+
+TEST(NetworkPacketTest, ReusesBuffers)
+{
+    {
+        auto warmup = CreateTestPacket(0);
+    }
+    const auto allocated = NetworkPacket::GetAllocatedBufferCount();
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        auto packet = CreateTestPacket(i);
+        AssertTestPacket(packet, i);
+    }
+    ASSERT_EQ(NetworkPacket::GetAllocatedBufferCount(), allocated);
+}
+
+TEST(NetworkPacketTest, LoopbackBroadcast)
+{
+    constexpr size_t NumClients = 8;
+    constexpr uint32_t NumPackets = 2000;
+
+    std::unique_ptr<ITcpSocket> listener;
+    uint16_t port = 0;
+    for (uint16_t candidate = 11760; candidate < 11790 && port == 0; candidate++)
+    {
+        try
+        {
+            listener = CreateTcpSocket();
+            listener->Listen("127.0.0.1", candidate);
+            port = candidate;
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+    if (port == 0)
+    {
+        GTEST_SKIP() << "Unable to listen on localhost";
+    }
+
+    std::vector<std::unique_ptr<NetworkConnection>> serverConnections;
+    std::vector<std::unique_ptr<NetworkConnection>> clientConnections;
+    for (size_t i = 0; i < NumClients; i++)
+    {
+        auto client = std::make_unique<NetworkConnection>();
+        client->Socket = CreateTcpSocket();
+        client->Socket->Connect("127.0.0.1", port);
+
+        std::unique_ptr<ITcpSocket> accepted;
+        for (int32_t attempt = 0; attempt < 200 && accepted == nullptr; attempt++)
+        {
+            accepted = listener->Accept();
+            if (accepted == nullptr)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+        ASSERT_NE(accepted, nullptr);
+
+        auto server = std::make_unique<NetworkConnection>();
+        server->Socket = std::move(accepted);
+        server->AuthStatus = NetworkAuth::Ok;
+        serverConnections.push_back(std::move(server));
+        clientConnections.push_back(std::move(client));
+    }
+
+    std::vector<uint32_t> received(NumClients);
+    const auto receiveAll = [&]() {
+        for (size_t i = 0; i < NumClients; i++)
+        {
+            auto& client = *clientConnections[i];
+            while (client.ReadPacket() == NetworkReadPacket::Success)
+            {
+                AssertTestPacket(client.InboundPacket, received[i]);
+                client.InboundPacket.Clear();
+                received[i]++;
+            }
+        }
+    };
+
+    // Every packet is encoded once and queued to all connections, the buffers come from the pool.
+    const auto allocatedBefore = NetworkPacket::GetAllocatedBufferCount();
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < NumPackets; i++)
+    {
+        const auto packet = CreateTestPacket(i);
+        for (auto& server : serverConnections)
+        {
+            server->QueuePacket(packet);
+            server->SendQueuedPackets();
+        }
+        receiveAll();
+    }
+
+    const auto timeout = std::chrono::high_resolution_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::high_resolution_clock::now() < timeout)
+    {
+        for (auto& server : serverConnections)
+        {
+            server->SendQueuedPackets();
+        }
+        receiveAll();
+        if (std::all_of(received.begin(), received.end(), [](uint32_t count) { return count == NumPackets; }))
+        {
+            break;
+        }
+    }
+    const auto endTime = std::chrono::high_resolution_clock::now();
+
+    for (auto count : received)
+    {
+        ASSERT_EQ(count, NumPackets);
+    }
+
+    // Only the first inbound packet of every client and the first outbound packet need a new buffer.
+    const auto allocated = NetworkPacket::GetAllocatedBufferCount() - allocatedBefore;
+    ASSERT_LE(allocated, NumClients + 2);
+
+    const auto elapsed = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    RecordProperty("BroadcastPackets", static_cast<int>(NumPackets * NumClients));
+    RecordProperty("ElapsedMs", std::to_string(elapsed));
+    RecordProperty("AllocatedBuffers", static_cast<int>(allocated));
+}
+
+#endif
@@ -0,0 +1,162 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/core/OrcaStream.hpp>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr uint32_t TestChunkCount = 8;
+
+static MemoryStream WriteTestStream(uint32_t compression)
+{
+    MemoryStream ms;
+    {
+        OrcaStream os(ms, OrcaStream::Mode::WRITING);
+        os.GetHeader().Compression = compression;
+        for (uint32_t id = 1; id <= TestChunkCount; id++)
+        {
+            os.ReadWriteChunk(id, [id](OrcaStream::ChunkStream& cs) {
+                // Chunks of different lengths, the last one is empty.
+                const uint32_t count = (TestChunkCount - id) * 1000;
+                cs.Write(count);
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    cs.Write(id * i);
+                }
+            });
+        }
+    }
+    ms.SetPosition(0);
+    return ms;
+}
+
+static void AssertChunk(OrcaStream& os, uint32_t id)
+{
+    auto found = os.ReadWriteChunk(id, [id](OrcaStream::ChunkStream& cs) {
+        const auto count = cs.Read<uint32_t>();
+        ASSERT_EQ(count, (TestChunkCount - id) * 1000);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(cs.Read<uint32_t>(), id * i);
+        }
+    });
+    ASSERT_TRUE(found);
+}
+
+TEST(OrcaStreamTest, GzipChunks)
+{
+    auto ms = WriteTestStream(OrcaStream::COMPRESSION_GZIP_CHUNKS);
+    OrcaStream os(ms, OrcaStream::Mode::READING);
+    ASSERT_EQ(os.GetHeader().Compression, OrcaStream::COMPRESSION_GZIP_CHUNKS);
+    ASSERT_EQ(os.GetHeader().NumChunks, TestChunkCount);
+
+    // Chunks are decompressed on first access, in any order.
+    AssertChunk(os, 5);
+    AssertChunk(os, 2);
+    AssertChunk(os, 5);
+    ASSERT_FALSE(os.ReadWriteChunk(TestChunkCount + 1, [](OrcaStream::ChunkStream&) {}));
+
+    os.DecompressChunks();
+    for (uint32_t id = 1; id <= TestChunkCount; id++)
+    {
+        AssertChunk(os, id);
+    }
+}
+
+TEST(OrcaStreamTest, Gzip)
+{
+    // Files saved before chunks were compressed separately must still load.
+    auto ms = WriteTestStream(OrcaStream::COMPRESSION_GZIP);
+    OrcaStream os(ms, OrcaStream::Mode::READING);
+    ASSERT_EQ(os.GetHeader().Compression, OrcaStream::COMPRESSION_GZIP);
+    os.DecompressChunks();
+    for (uint32_t id = TestChunkCount; id >= 1; id--)
+    {
+        AssertChunk(os, id);
+    }
+}
+
+TEST(OrcaStreamTest, CorruptChunk)
+{
+    auto ms = WriteTestStream(OrcaStream::COMPRESSION_GZIP_CHUNKS);
+    auto* data = static_cast<uint8_t*>(const_cast<void*>(ms.GetData()));
+
+    // Overwrite the middle of the first compressed chunk, the tables before it are left intact.
+    constexpr size_t tablesSize = 64 + TestChunkCount * (20 + 16);
+    std::fill(data + tablesSize + 32, data + tablesSize + 96, 0xFF);
+    OrcaStream os(ms, OrcaStream::Mode::READING);
+    ASSERT_ANY_THROW(os.DecompressChunks());
+}
+
+TEST(OrcaStreamTest, Compress)
+{
+    // Background saves write the chunks without compression first and compress them afterwards.
+    auto uncompressed = WriteTestStream(OrcaStream::COMPRESSION_NONE);
+    MemoryStream ms;
+    OrcaStream::Compress(uncompressed, ms, OrcaStream::COMPRESSION_GZIP_CHUNKS);
+    ASSERT_LT(ms.GetLength(), uncompressed.GetLength());
+
+    ms.SetPosition(0);
+    OrcaStream os(ms, OrcaStream::Mode::READING);
+    ASSERT_EQ(os.GetHeader().Compression, OrcaStream::COMPRESSION_GZIP_CHUNKS);
+    for (uint32_t id = 1; id <= TestChunkCount; id++)
+    {
+        AssertChunk(os, id);
+    }
+}
+
+TEST(OrcaStreamTest, EmptyChunk)
+{
+    MemoryStream ms;
+    {
+        OrcaStream os(ms, OrcaStream::Mode::WRITING);
+        os.ReadWriteChunk(1, [](OrcaStream::ChunkStream&) {});
+        os.ReadWriteChunk(2, [](OrcaStream::ChunkStream& cs) { cs.Write(uint32_t{ 42 }); });
+        os.ReadWriteChunk(3, [](OrcaStream::ChunkStream&) {});
+    }
+    ms.SetPosition(0);
+
+    OrcaStream os(ms, OrcaStream::Mode::READING);
+    ASSERT_EQ(os.GetHeader().Compression, OrcaStream::COMPRESSION_GZIP_CHUNKS);
+    os.DecompressChunks();
+    ASSERT_TRUE(os.ReadWriteChunk(1, [](OrcaStream::ChunkStream&) {}));
+    ASSERT_TRUE(os.ReadWriteChunk(2, [](OrcaStream::ChunkStream& cs) { ASSERT_EQ(cs.Read<uint32_t>(), 42u); }));
+    ASSERT_TRUE(os.ReadWriteChunk(3, [](OrcaStream::ChunkStream&) {}));
+}
+
+TEST(OrcaStreamTest, CorruptTables)
+{
+    constexpr size_t headerSize = 64;
+    constexpr size_t compressedSizeOffset = 28;
+    constexpr size_t compressedTableOffset = headerSize + TestChunkCount * 20;
+
+    // A compressed chunk whose offset and length overflow when added together.
+    {
+        auto ms = WriteTestStream(OrcaStream::COMPRESSION_GZIP_CHUNKS);
+        auto* data = static_cast<uint8_t*>(const_cast<void*>(ms.GetData()));
+        const uint64_t offset = 16;
+        const uint64_t length = ~uint64_t{ 0 };
+        std::memcpy(data + compressedTableOffset, &offset, sizeof(offset));
+        std::memcpy(data + compressedTableOffset + 8, &length, sizeof(length));
+        ASSERT_ANY_THROW({ OrcaStream os(ms, OrcaStream::Mode::READING); });
+    }
+
+    // A compressed size larger than the data that follows the tables.
+    {
+        auto ms = WriteTestStream(OrcaStream::COMPRESSION_GZIP_CHUNKS);
+        auto* data = static_cast<uint8_t*>(const_cast<void*>(ms.GetData()));
+        const uint64_t compressedSize = uint64_t{ 1 } << 40;
+        std::memcpy(data + compressedSizeOffset, &compressedSize, sizeof(compressedSize));
+        ASSERT_ANY_THROW({ OrcaStream os(ms, OrcaStream::Mode::READING); });
+    }
+}
@@ -0,0 +1,153 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/paint/Paint.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct BoundsGenerator
+    {
+        // Area of tiles the paint structs are spread over.
+        int32_t Tiles;
+        // Range of the bounding box length in x and y.
+        int32_t MinLength;
+        int32_t MaxLength;
+        // Range of the base height and of the height of each bounding box.
+        int32_t MaxZ;
+        int32_t MaxHeight;
+    };
+
+    // Paint structs with the same bounding boxes added to a session the same way the painter does.
+    class TestPaintSession
+    {
+    public:
+        TestPaintSession(const std::vector<PaintStructBoundBox>& bounds, uint8_t rotation)
+            : _session(std::make_unique<PaintSessionCore>())
+            , _structs(bounds.size())
+        {
+            std::fill(std::begin(_session->Quadrants), std::end(_session->Quadrants), nullptr);
+            _session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
+            _session->QuadrantFrontIndex = 0;
+            _session->CurrentRotation = rotation;
+
+            for (size_t i = 0; i < bounds.size(); i++)
+            {
+                auto& ps = _structs[i];
+                ps.Bounds = bounds[i];
+
+                const uint32_t quadrantIndex = std::clamp(GetPositionHash(ps, rotation) / COORDS_XY_STEP, 0, MaxPaintQuadrants - 1);
+                ps.QuadrantIndex = quadrantIndex;
+                ps.NextQuadrantEntry = _session->Quadrants[quadrantIndex];
+                _session->Quadrants[quadrantIndex] = &ps;
+                _session->QuadrantBackIndex = std::min(_session->QuadrantBackIndex, quadrantIndex);
+                _session->QuadrantFrontIndex = std::max(_session->QuadrantFrontIndex, quadrantIndex);
+            }
+        }
+
+        std::vector<size_t> Arrange(PaintSortMode mode)
+        {
+            PaintSessionArrange(*_session, mode);
+
+            std::vector<size_t> result;
+            for (auto* ps = _session->PaintHead; ps != nullptr; ps = ps->NextQuadrantEntry)
+            {
+                result.push_back(ps - _structs.data());
+            }
+            return result;
+        }
+
+    private:
+        static int32_t GetPositionHash(const PaintStruct& ps, uint8_t rotation)
+        {
+            constexpr auto mapRangeMax = MaxPaintQuadrants * COORDS_XY_STEP;
+            constexpr auto mapRangeCenter = mapRangeMax / 2;
+            switch (rotation)
+            {
+                case 0:
+                    return ps.Bounds.x + ps.Bounds.y;
+                case 1:
+                    return (ps.Bounds.y - ps.Bounds.x) + mapRangeCenter;
+                case 2:
+                    return (-(ps.Bounds.y + ps.Bounds.x)) + mapRangeMax;
+                default:
+                    return (ps.Bounds.x - ps.Bounds.y) + mapRangeCenter;
+            }
+        }
+
+        std::unique_ptr<PaintSessionCore> _session;
+        std::vector<PaintStruct> _structs;
+    };
+} // namespace
+
+static std::vector<PaintStructBoundBox> GenerateBounds(std::mt19937& prng, const BoundsGenerator& generator, size_t count)
+{
+    std::uniform_int_distribution<int32_t> tileDist(0, generator.Tiles - 1);
+    std::uniform_int_distribution<int32_t> offsetDist(0, 31);
+    std::uniform_int_distribution<int32_t> lengthDist(generator.MinLength, generator.MaxLength);
+    std::uniform_int_distribution<int32_t> zDist(0, generator.MaxZ);
+    std::uniform_int_distribution<int32_t> heightDist(0, generator.MaxHeight);
+
+    // Keep clear of the map edge so that rotated positions stay inside the quadrant range.
+    constexpr int32_t origin = 64 * COORDS_XY_STEP;
+
+    std::vector<PaintStructBoundBox> result(count);
+    for (auto& bounds : result)
+    {
+        bounds.x = origin + tileDist(prng) * COORDS_XY_STEP + offsetDist(prng);
+        bounds.y = origin + tileDist(prng) * COORDS_XY_STEP + offsetDist(prng);
+        bounds.z = zDist(prng);
+        bounds.x_end = bounds.x + lengthDist(prng);
+        bounds.y_end = bounds.y + lengthDist(prng);
+        bounds.z_end = bounds.z + heightDist(prng);
+    }
+    return result;
+}
+
+static void AssertSameOrder(const BoundsGenerator& generator, size_t count, uint32_t seeds)
+{
+    for (uint32_t seed = 0; seed < seeds; seed++)
+    {
+        std::mt19937 prng(seed);
+        const auto bounds = GenerateBounds(prng, generator, count);
+        for (uint8_t rotation = 0; rotation < 4; rotation++)
+        {
+            const auto expected = TestPaintSession(bounds, rotation).Arrange(PaintSortMode::Legacy);
+            const auto actual = TestPaintSession(bounds, rotation).Arrange(PaintSortMode::Bucketed);
+            ASSERT_EQ(expected.size(), count);
+            ASSERT_EQ(expected, actual) << "seed " << seed << ", rotation " << static_cast<int32_t>(rotation);
+        }
+    }
+}
+
+TEST(PaintSortTest, Empty)
+{
+    ASSERT_TRUE(TestPaintSession({}, 0).Arrange(PaintSortMode::Bucketed).empty());
+}
+
+TEST(PaintSortTest, Scenery)
+{
+    // Small objects scattered over a park.
+    AssertSameOrder({ 16, -1, 31, 128, 64 }, 500, 20);
+}
+
+TEST(PaintSortTest, DenseScenery)
+{
+    // Many overlapping objects on a handful of tiles.
+    AssertSameOrder({ 3, -1, 40, 64, 32 }, 400, 20);
+}
+
+TEST(PaintSortTest, TallStacks)
+{
+    // Coaster stacks, large bounding boxes going high up on few tiles.
+    AssertSameOrder({ 4, 0, 96, 2000, 400 }, 400, 20);
+}
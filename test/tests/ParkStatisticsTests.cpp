@@ -0,0 +1,108 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/Game.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/entity/Litter.h>
+#include <openrct2/world/ParkStatistics.h>
+
+using namespace OpenRCT2;
+
+class ParkStatisticsTests : public testing::Test
+{
+protected:
+    uint32_t _currentTicks{};
+
+    void SetUp() override
+    {
+        ResetAllEntities();
+        _currentTicks = gCurrentTicks;
+        gCurrentTicks = 10000;
+    }
+
+    void TearDown() override
+    {
+        ResetAllEntities();
+        gCurrentTicks = _currentTicks;
+    }
+
+    static Guest* CreateGuest(bool outsideOfPark, uint8_t happiness, PeepThoughtType thought, uint8_t freshness)
+    {
+        auto* guest = CreateEntity<Guest>();
+        guest->OutsideOfPark = outsideOfPark;
+        guest->Happiness = happiness;
+        guest->PeepFlags = 0;
+        guest->GuestIsLostCountdown = 0;
+        for (auto& peepThought : guest->Thoughts)
+        {
+            peepThought.type = PeepThoughtType::None;
+            peepThought.freshness = 0;
+        }
+        guest->Thoughts[0].type = thought;
+        guest->Thoughts[0].freshness = freshness;
+        return guest;
+    }
+};
+
+TEST_F(ParkStatisticsTests, CountsGuestsInsideThePark)
+{
+    CreateGuest(false, 200, PeepThoughtType::Hungry, 0);
+    CreateGuest(false, 100, PeepThoughtType::Hungry, 5);
+    CreateGuest(false, 129, PeepThoughtType::Hungry, 6);
+    CreateGuest(false, 128, PeepThoughtType::Toilet, 1);
+    CreateGuest(true, 255, PeepThoughtType::Hungry, 0);
+
+    auto* lostGuest = CreateGuest(false, 0, PeepThoughtType::Lost, 2);
+    lostGuest->PeepFlags |= PEEP_FLAGS_LEAVING_PARK;
+    lostGuest->GuestIsLostCountdown = 89;
+    auto* leavingGuest = CreateGuest(false, 0, PeepThoughtType::None, 0);
+    leavingGuest->PeepFlags |= PEEP_FLAGS_LEAVING_PARK;
+    leavingGuest->GuestIsLostCountdown = 90;
+
+    const auto stats = GatherParkStatistics();
+    ASSERT_EQ(stats.Guests, 6u);
+    ASSERT_EQ(stats.HappyGuests, 2u);
+    ASSERT_EQ(stats.LostGuests, 1u);
+    ASSERT_EQ(stats.GetFreshThoughtCount(PeepThoughtType::Hungry), 2u);
+    ASSERT_EQ(stats.GetFreshThoughtCount(PeepThoughtType::Toilet), 1u);
+    ASSERT_EQ(stats.GetFreshThoughtCount(PeepThoughtType::Lost), 1u);
+    ASSERT_EQ(stats.GetFreshThoughtCount(PeepThoughtType::Vandalism), 0u);
+}
+
+TEST_F(ParkStatisticsTests, CountsOldLitter)
+{
+    for (auto age : { 0u, 7679u, 7680u, 9000u })
+    {
+        auto* litter = CreateEntity<Litter>();
+        ASSERT_NE(litter, nullptr);
+        litter->creationTick = gCurrentTicks - age;
+    }
+
+    const auto stats = GatherParkStatistics();
+    ASSERT_EQ(stats.OldLitter, 2u);
+}
+
+TEST_F(ParkStatisticsTests, GathersOnlyRequestedParts)
+{
+    CreateGuest(false, 200, PeepThoughtType::Hungry, 0);
+    auto* litter = CreateEntity<Litter>();
+    ASSERT_NE(litter, nullptr);
+    litter->creationTick = gCurrentTicks - 9000;
+
+    auto stats = GatherParkStatistics(EnumToFlag(ParkStatisticsPart::Guests));
+    ASSERT_EQ(stats.Guests, 1u);
+    ASSERT_EQ(stats.OldLitter, 0u);
+
+    stats = GatherParkStatistics(EnumToFlag(ParkStatisticsPart::Litter));
+    ASSERT_EQ(stats.Guests, 0u);
+    ASSERT_EQ(stats.GetFreshThoughtCount(PeepThoughtType::Hungry), 0u);
+    ASSERT_EQ(stats.OldLitter, 1u);
+}
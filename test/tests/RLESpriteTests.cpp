@@ -0,0 +1,143 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/ImageImporter.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2::Drawing;
+
+using BlitRLERunFunc = decltype(&BlitRLERunScalar);
+
+class RLESpriteTests : public testing::Test
+{
+protected:
+    static constexpr DrawBlendOp BlendOps[] = {
+        BLEND_TRANSPARENT,
+        BLEND_TRANSPARENT | BLEND_SRC,
+        BLEND_TRANSPARENT | BLEND_DST,
+        BLEND_TRANSPARENT | BLEND_SRC | BLEND_DST,
+    };
+
+    ImageImporter::ImportResult _sprite;
+    uint8_t _remap[256]{};
+    std::vector<uint8_t> _blendMaps;
+    std::vector<uint8_t> _background;
+
+    void SetUp() override
+    {
+        auto logoPath = Path::Combine(TestData::GetBasePath(), u8"images", u8"logo.png");
+        auto image = Imaging::ReadFromFile(logoPath, IMAGE_FORMAT::PNG_32);
+        ImageImporter importer;
+        _sprite = importer.Import(image, 0, 0, ImageImporter::Palette::OpenRCT2, ImageImporter::ImportFlags::RLE);
+
+        // Some entries map to 0 so the remapped transparency is covered as well.
+        std::mt19937 random(1234);
+        for (size_t i = 0; i < std::size(_remap); i++)
+        {
+            _remap[i] = (i % 29) == 0 ? 0 : static_cast<uint8_t>(random());
+        }
+        _blendMaps.resize(255 * 256);
+        for (auto& entry : _blendMaps)
+        {
+            entry = (random() % 32) == 0 ? 0 : static_cast<uint8_t>(random());
+        }
+        _background.resize(static_cast<size_t>(_sprite.Element.width) * _sprite.Element.height);
+        for (auto& pixel : _background)
+        {
+            pixel = static_cast<uint8_t>(random());
+        }
+    }
+
+    PaletteMap GetPaletteMap(DrawBlendOp blendOp)
+    {
+        if ((blendOp & BLEND_SRC) != 0 && (blendOp & BLEND_DST) != 0)
+        {
+            return PaletteMap(_blendMaps.data(), 255, 256);
+        }
+        return PaletteMap(_remap);
+    }
+
+    // Walks the runs of the whole sprite the same way the RLE sprite drawing does.
+    std::vector<uint8_t> Draw(BlitRLERunFunc blit, DrawBlendOp blendOp, int32_t zoomLevel)
+    {
+        const auto& element = _sprite.Element;
+        const auto paletteMap = GetPaletteMap(blendOp);
+        const auto zoom = 1 << zoomLevel;
+        const auto pitch = static_cast<size_t>(element.width);
+        auto result = _background;
+        for (int32_t y = 0; y < element.height; y += zoom)
+        {
+            const uint16_t lineOffset = element.offset[y * 2] | (element.offset[y * 2 + 1] << 8);
+            const uint8_t* nextRun = element.offset + lineOffset;
+            auto* dstLine = result.data() + pitch * (y >> zoomLevel);
+            auto isEndOfLine = false;
+            while (!isEndOfLine)
+            {
+                const auto* src = nextRun;
+                uint8_t dataSize = *src++;
+                int32_t x = *src++;
+                isEndOfLine = (dataSize & 0x80) != 0;
+                dataSize &= 0x7F;
+                nextRun = src + dataSize;
+
+                int32_t numPixels = dataSize;
+                auto mod = x & (zoom - 1);
+                if (mod != 0)
+                {
+                    x += zoom - mod;
+                    src += zoom - mod;
+                    numPixels -= zoom - mod;
+                }
+                blit(src, dstLine + (x >> zoomLevel), numPixels, zoomLevel, blendOp, paletteMap);
+            }
+        }
+        return result;
+    }
+
+    static std::vector<std::pair<std::string, BlitRLERunFunc>> GetKernels()
+    {
+        std::vector<std::pair<std::string, BlitRLERunFunc>> kernels;
+        kernels.emplace_back("Scalar", BlitRLERunScalar);
+        if (SSE41Available())
+        {
+            kernels.emplace_back("Sse4_1", BlitRLERunSse4_1);
+        }
+        if (AVX2Available())
+        {
+            kernels.emplace_back("Avx2", BlitRLERunAvx2);
+        }
+        return kernels;
+    }
+};
+
+TEST_F(RLESpriteTests, KernelsMatchScalar)
+{
+    ASSERT_EQ(128, _sprite.Element.width);
+    for (auto blendOp : BlendOps)
+    {
+        for (int32_t zoomLevel = 0; zoomLevel <= 3; zoomLevel++)
+        {
+            const auto expected = Draw(BlitRLERunScalar, blendOp, zoomLevel);
+            ASSERT_NE(expected, _background);
+            for (const auto& [name, blit] : GetKernels())
+            {
+                ASSERT_EQ(expected, Draw(blit, blendOp, zoomLevel))
+                    << name << ", blend op " << static_cast<int32_t>(blendOp) << ", zoom level " << zoomLevel;
+            }
+        }
+    }
+}
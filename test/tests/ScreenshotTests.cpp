@@ -0,0 +1,74 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileSystem.hpp>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/interface/Screenshot.h>
+#include <string>
+
+using namespace OpenRCT2;
+
+class ScreenshotServerTests : public testing::Test
+{
+protected:
+    fs::path _outputDirectory;
+
+    void SetUp() override
+    {
+        _outputDirectory = fs::temp_directory_path() / "openrct2-screenshot-server-tests";
+        fs::remove_all(_outputDirectory);
+        fs::create_directories(_outputDirectory);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_outputDirectory);
+    }
+
+    std::string GetOutputPath(const std::string& name) const
+    {
+        return (_outputDirectory / name).string();
+    }
+
+    int32_t RunJobs(const std::string& name, const std::string& jobs) const
+    {
+        const auto jobsPath = GetOutputPath(name);
+        {
+            std::ofstream jobsFile(fs::u8path(jobsPath));
+            jobsFile << jobs;
+        }
+
+        ScreenshotOptions options;
+        return CommandLineForScreenshotServer(jobsPath.c_str(), &options);
+    }
+
+    std::string GetJob(const std::string& park, const std::string& output) const
+    {
+        return "\"" + TestData::GetParkPath(park) + "\" \"" + GetOutputPath(output) + "\" 640 480\n";
+    }
+};
+
+TEST_F(ScreenshotServerTests, JobsForDifferentParks)
+{
+    // The second park is rendered after another park was loaded in the same server.
+    auto jobs = GetJob("bpb.sv6", "first.png") + GetJob("small_park_with_ferris_wheel.sv6", "second.png");
+    ASSERT_EQ(RunJobs("jobs.txt", jobs), 1);
+
+    // Both parks on their own, nothing cached from a previous park.
+    ASSERT_EQ(RunJobs("first.txt", GetJob("bpb.sv6", "first-alone.png")), 1);
+    ASSERT_EQ(RunJobs("second.txt", GetJob("small_park_with_ferris_wheel.sv6", "second-alone.png")), 1);
+
+    ASSERT_EQ(File::ReadAllBytes(GetOutputPath("first.png")), File::ReadAllBytes(GetOutputPath("first-alone.png")));
+    ASSERT_EQ(File::ReadAllBytes(GetOutputPath("second.png")), File::ReadAllBytes(GetOutputPath("second-alone.png")));
+}
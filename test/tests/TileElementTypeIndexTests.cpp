@@ -0,0 +1,80 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/world/TileElementTypeIndex.hpp>
+#include <vector>
+
+static TileElement CreateElement(TileElementType type, bool lastForTile)
+{
+    TileElement element{};
+    element.ClearAs(type);
+    element.SetLastForTile(lastForTile);
+    return element;
+}
+
+// 2x2 map: (0,0) surface and path, (1,0) surface, (0,1) track and surface and wall, (1,1) surface.
+static std::vector<TileElement> CreateElements()
+{
+    return {
+        CreateElement(TileElementType::Surface, false), CreateElement(TileElementType::Path, true),
+        CreateElement(TileElementType::Surface, true),  CreateElement(TileElementType::Track, false),
+        CreateElement(TileElementType::Surface, false), CreateElement(TileElementType::Wall, true),
+        CreateElement(TileElementType::Surface, true),
+    };
+}
+
+TEST(TileElementTypeIndexTest, Build)
+{
+    auto elements = CreateElements();
+    TileElementTypeIndex index(2, elements.data(), elements.size());
+
+    ASSERT_TRUE(index.HasType({ 0, 0 }, TileElementType::Surface));
+    ASSERT_TRUE(index.HasType({ 0, 0 }, TileElementType::Path));
+    ASSERT_FALSE(index.HasType({ 0, 0 }, TileElementType::Track));
+
+    ASSERT_TRUE(index.HasType({ 1, 0 }, TileElementType::Surface));
+    ASSERT_FALSE(index.HasType({ 1, 0 }, TileElementType::Path));
+
+    ASSERT_TRUE(index.HasType({ 0, 1 }, TileElementType::Track));
+    ASSERT_TRUE(index.HasType({ 0, 1 }, TileElementType::Wall));
+    ASSERT_FALSE(index.HasType({ 0, 1 }, TileElementType::Banner));
+
+    ASSERT_TRUE(index.HasType({ 1, 1 }, TileElementType::Surface));
+    ASSERT_FALSE(index.HasType({ 1, 1 }, TileElementType::LargeScenery));
+}
+
+TEST(TileElementTypeIndexTest, AddType)
+{
+    auto elements = CreateElements();
+    TileElementTypeIndex index(2, elements.data(), elements.size());
+
+    index.AddType({ 1, 1 }, TileElementType::Banner);
+    ASSERT_TRUE(index.HasType({ 1, 1 }, TileElementType::Banner));
+    ASSERT_TRUE(index.HasType({ 1, 1 }, TileElementType::Surface));
+    ASSERT_FALSE(index.HasType({ 1, 0 }, TileElementType::Banner));
+}
+
+TEST(TileElementTypeIndexTest, SetTile)
+{
+    auto elements = CreateElements();
+    TileElementTypeIndex index(2, elements.data(), elements.size());
+
+    // Types are recalculated from the elements of the tile.
+    elements[1].ClearAs(TileElementType::SmallScenery);
+    elements[1].SetLastForTile(true);
+    index.SetTile({ 0, 0 }, &elements[0]);
+    ASSERT_TRUE(index.HasType({ 0, 0 }, TileElementType::SmallScenery));
+    ASSERT_FALSE(index.HasType({ 0, 0 }, TileElementType::Path));
+
+    // A tile without elements has no types.
+    index.SetTile({ 0, 0 }, nullptr);
+    ASSERT_FALSE(index.HasType({ 0, 0 }, TileElementType::Surface));
+    ASSERT_TRUE(index.HasType({ 0, 1 }, TileElementType::Wall));
+}
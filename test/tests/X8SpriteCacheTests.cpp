@@ -0,0 +1,187 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/Image.h>
+#include <openrct2/drawing/ImageImporter.h>
+#include <openrct2/drawing/X8SpriteCache.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+class X8SpriteCacheTests : public testing::Test
+{
+protected:
+    ImageImporter::ImportResult _logo;
+    ImageIndex _baseImage = ImageIndexUndefined;
+    std::vector<uint8_t> _background;
+    bool _noGraphics{};
+
+    void SetUp() override
+    {
+        _noGraphics = gOpenRCT2NoGraphics;
+        gOpenRCT2NoGraphics = false;
+
+        auto logoPath = Path::Combine(TestData::GetBasePath(), u8"images", u8"logo.png");
+        auto image = Imaging::ReadFromFile(logoPath, IMAGE_FORMAT::PNG_32);
+        ImageImporter importer;
+        _logo = importer.Import(image, -64, -96, ImageImporter::Palette::OpenRCT2, ImageImporter::ImportFlags::RLE);
+
+        // The second image uses the first one as its zoomed out version.
+        G1Element elements[2] = { _logo.Element, _logo.Element };
+        elements[1].flags |= G1_FLAG_HAS_ZOOM_SPRITE;
+        elements[1].zoomed_offset = 1;
+        _baseImage = GfxObjectAllocateImages(elements, 2);
+        ASSERT_NE(_baseImage, UINT32_MAX);
+
+        std::mt19937 random(1234);
+        _background.resize(256 * 256);
+        for (auto& pixel : _background)
+        {
+            pixel = static_cast<uint8_t>(random());
+        }
+    }
+
+    void TearDown() override
+    {
+        GfxObjectFreeImages(_baseImage, 2);
+        gOpenRCT2NoGraphics = _noGraphics;
+    }
+
+    std::vector<ImageId> GetImages() const
+    {
+        return {
+            ImageId(_baseImage),
+            ImageId(_baseImage + 1),
+            ImageId(_baseImage, COLOUR_BRIGHT_RED),
+            ImageId(_baseImage, COLOUR_BRIGHT_RED, COLOUR_DARK_GREEN),
+            ImageId(_baseImage + 1, COLOUR_BRIGHT_RED, COLOUR_DARK_GREEN, COLOUR_WHITE),
+        };
+    }
+
+    DrawPixelInfo CreateDPI(
+        std::vector<uint8_t>& bits, ZoomLevel zoomLevel, int32_t x, int32_t y, int32_t width, int32_t height)
+    {
+        bits = _background;
+        DrawPixelInfo dpi{};
+        dpi.bits = bits.data();
+        dpi.x = x;
+        dpi.y = y;
+        dpi.width = width;
+        dpi.height = height;
+        dpi.zoom_level = zoomLevel;
+        // Leave room on the right, zoomed pixels that start inside the area can be drawn past its width.
+        dpi.pitch = 256 - zoomLevel.ApplyInversedTo(width);
+        return dpi;
+    }
+};
+
+TEST_F(X8SpriteCacheTests, MatchesSoftwareDrawing)
+{
+    X8SpriteCache cache;
+    std::vector<uint8_t> expected;
+    std::vector<uint8_t> actual;
+    for (int8_t level = 0; level <= 3; level++)
+    {
+        const ZoomLevel zoomLevel{ level };
+        const int32_t zoom = zoomLevel.ApplyTo(1);
+        for (const auto& size : { ScreenSize{ 160, 120 }, ScreenSize{ 33, 57 }, ScreenSize{ 101, 7 } })
+        {
+            const auto width = std::min(size.width * zoom, 200 * zoom);
+            const auto height = std::min(size.height * zoom, 200 * zoom);
+            for (int32_t y = -200; y <= 240; y += 37)
+            {
+                for (int32_t x = -200; x <= 240; x += 29)
+                {
+                    for (const auto imageId : GetImages())
+                    {
+                        auto expectedDPI = CreateDPI(expected, zoomLevel, -8 * zoom, 16 * zoom, width, height);
+                        GfxDrawSpriteSoftware(expectedDPI, imageId, { x, y });
+
+                        auto actualDPI = CreateDPI(actual, zoomLevel, -8 * zoom, 16 * zoom, width, height);
+                        ASSERT_TRUE(cache.Draw(actualDPI, imageId, { x, y }));
+                        ASSERT_EQ(expected, actual) << "zoom level " << static_cast<int32_t>(level) << " at " << x << ", " << y
+                                                    << ", area " << width << "x" << height;
+                    }
+                }
+            }
+        }
+    }
+
+    const auto stats = cache.GetStats();
+    ASSERT_GT(stats.Hits, stats.Misses);
+}
+
+TEST_F(X8SpriteCacheTests, SkipsUncachableSprites)
+{
+    X8SpriteCache cache;
+    std::vector<uint8_t> bits;
+    auto dpi = CreateDPI(bits, ZoomLevel{ 0 }, 0, 0, 128, 128);
+    ASSERT_FALSE(cache.Draw(dpi, ImageId(_baseImage).WithTransparency(FilterPaletteID::PaletteDarken1), { 0, 0 }));
+
+    // Areas that are not aligned to the zoom level sample other pixels than the cached ones.
+    dpi = CreateDPI(bits, ZoomLevel{ 2 }, 2, 0, 128, 128);
+    ASSERT_FALSE(cache.Draw(dpi, ImageId(_baseImage), { 0, 0 }));
+    ASSERT_EQ(cache.GetStats().Sprites, 0u);
+}
+
+TEST_F(X8SpriteCacheTests, InvalidateImage)
+{
+    X8SpriteCache cache;
+    std::vector<uint8_t> bits;
+    auto dpi = CreateDPI(bits, ZoomLevel{ 1 }, 0, 0, 128, 128);
+    cache.Draw(dpi, ImageId(_baseImage), { 0, 0 });
+    cache.Draw(dpi, ImageId(_baseImage + 1), { 0, 0 });
+    cache.Draw(dpi, ImageId(_baseImage + 1), { 0, 0 });
+
+    auto stats = cache.GetStats();
+    ASSERT_EQ(stats.Sprites, 2u);
+    ASSERT_EQ(stats.Misses, 2u);
+    ASSERT_EQ(stats.Hits, 1u);
+    ASSERT_GT(stats.MemoryUsage, 0u);
+
+    // The zoomed out image drawn for the second one is the first image.
+    cache.Invalidate(_baseImage);
+    stats = cache.GetStats();
+    ASSERT_EQ(stats.Sprites, 0u);
+    ASSERT_EQ(stats.MemoryUsage, 0u);
+}
+
+TEST_F(X8SpriteCacheTests, EvictsLeastRecentlyUsed)
+{
+    std::vector<uint8_t> bits;
+    auto dpi = CreateDPI(bits, ZoomLevel{ 0 }, 0, 0, 128, 128);
+
+    X8SpriteCache measure;
+    measure.Draw(dpi, ImageId(_baseImage), { 0, 0 });
+    const auto spriteSize = measure.GetStats().MemoryUsage;
+
+    X8SpriteCache cache(spriteSize * 5 / 2);
+    const auto images = GetImages();
+    for (const auto imageId : images)
+    {
+        cache.Draw(dpi, imageId, { 0, 0 });
+    }
+    ASSERT_LE(cache.GetStats().MemoryUsage, spriteSize * 5 / 2);
+    ASSERT_LT(cache.GetStats().Sprites, images.size());
+
+    // The most recently drawn sprite is still there, the first one is gone
+    cache.Draw(dpi, images.back(), { 0, 0 });
+    ASSERT_EQ(cache.GetStats().Hits, 1u);
+    cache.Draw(dpi, images.front(), { 0, 0 });
+    ASSERT_EQ(cache.GetStats().Hits, 1u);
+}